@@ -32,12 +32,15 @@
 #include <bitcoin/system/version.hpp>
 #include <bitcoin/system/warnings.hpp>
 #include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/block_view.hpp>
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/chain/chain_state.hpp>
 #include <bitcoin/system/chain/checkpoint.hpp>
 #include <bitcoin/system/chain/compact.hpp>
 #include <bitcoin/system/chain/context.hpp>
 #include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/headers_view.hpp>
+#include <bitcoin/system/chain/history.hpp>
 #include <bitcoin/system/chain/input.hpp>
 #include <bitcoin/system/chain/operation.hpp>
 #include <bitcoin/system/chain/output.hpp>
@@ -46,6 +49,7 @@
 #include <bitcoin/system/chain/script.hpp>
 #include <bitcoin/system/chain/stripper.hpp>
 #include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/transaction_view.hpp>
 #include <bitcoin/system/chain/witness.hpp>
 #include <bitcoin/system/chain/enums/coverage.hpp>
 #include <bitcoin/system/chain/enums/flags.hpp>
@@ -257,6 +261,7 @@
 #include <bitcoin/system/wallet/mnemonics/electrum.hpp>
 #include <bitcoin/system/wallet/mnemonics/electrum_v1.hpp>
 #include <bitcoin/system/wallet/mnemonics/mnemonic.hpp>
+#include <bitcoin/system/wallet/mnemonics/recovery.hpp>
 #include <bitcoin/system/words/dictionaries.hpp>
 #include <bitcoin/system/words/dictionary.hpp>
 #include <bitcoin/system/words/language.hpp>
@@ -63,6 +63,11 @@ public:
     block(std::istream& stream, bool witness) NOEXCEPT;
     block(reader&& source, bool witness) NOEXCEPT;
     block(reader& source, bool witness) NOEXCEPT;
+    block(read::bytes::fast&& source, bool witness) NOEXCEPT;
+    block(read::bytes::fast& source, bool witness) NOEXCEPT;
+
+    /// Scripts and witnesses are shared through the pool.
+    block(reader& source, bool witness, script_pool& pool) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -113,7 +118,7 @@ public:
     const hash_digest& get_hash() const NOEXCEPT;
 
     /// Optimized hash derivations using wire serialization of same block.
-    void set_hashes(const data_chunk& data) NOEXCEPT;
+    void set_hashes(const data_slice& data) NOEXCEPT;
 
     /// Set/get memory allocation.
     void set_allocation(size_t allocation) const NOEXCEPT;
@@ -136,6 +141,16 @@ public:
     code connect(const context& ctx) const NOEXCEPT;
     code confirm(const context& ctx) const NOEXCEPT;
 
+    /// Connect non-coinbase inputs concurrently across the specified number
+    /// of threads (sequential if less than two). Returns the same code as the
+    /// sequential connect, the code of the first failing input in block order.
+    code connect(const context& ctx, size_t threads) const NOEXCEPT;
+
+    /// Connect with terminal signature checks deferred and then verified
+    /// sequentially (see verify_signatures, this is not batch verification).
+    /// Any failure reverts to the sequential connect for an identical code.
+    code connect_batched(const context& ctx) const NOEXCEPT;
+
     /// Populate previous outputs (only, no metadata) internal to the block.
     void populate() const NOEXCEPT;
 
@@ -197,7 +212,9 @@ private:
     using unordered_set_of_constant_referenced_hashes =
         std::unordered_set<hash_cref, hash_hash>;
 
-    void assign_data(reader& source, bool witness) NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source, bool witness,
+        script_pool* pool=nullptr) NOEXCEPT;
     static block from_data(reader& source, bool witness) NOEXCEPT;
     static sizes serialized_size(const chain::transaction_cptrs& txs) NOEXCEPT;
 
@@ -213,6 +230,8 @@ private:
     code check_transactions(const context& ctx) const NOEXCEPT;
     code accept_transactions(const context& ctx) const NOEXCEPT;
     code connect_transactions(const context& ctx) const NOEXCEPT;
+    code connect_transactions(const context& ctx,
+        size_t threads) const NOEXCEPT;
     code confirm_transactions(const context& ctx) const NOEXCEPT;
 
     // Block should be stored as shared (adds 16 bytes).
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_BLOCK_VIEW_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_BLOCK_VIEW_HPP
+
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/transaction_view.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// View of a wire-serialized block (with or without witness).
+/// Non-owning and non-allocating, the viewed buffer must outlive the view.
+class BC_API block_view
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(block_view);
+
+    /// Default view is an invalid (empty) object.
+    block_view() NOEXCEPT;
+
+    /// Data begins at the block, trailing bytes are not viewed.
+    block_view(const data_slice& data) NOEXCEPT;
+
+    /// Properties.
+    /// -----------------------------------------------------------------------
+
+    bool is_valid() const NOEXCEPT;
+    bool is_segregated() const NOEXCEPT;
+    size_t serialized_size(bool witness) const NOEXCEPT;
+
+    hash_digest hash() const NOEXCEPT;
+    chain::header header() const NOEXCEPT;
+    transaction_views transactions() const NOEXCEPT;
+
+    /// Viewed wire serialization (witness as viewed).
+    data_slice data() const NOEXCEPT;
+
+    /// Materialize the block, with transaction hashes cached.
+    chain::block to_block(bool witness) const NOEXCEPT;
+
+private:
+    data_slice data_;
+    data_slice txs_;
+    size_t count_;
+    size_t nominal_;
+    bool segregated_;
+    bool valid_;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -20,10 +20,12 @@
 #define LIBBITCOIN_SYSTEM_CHAIN_CHAIN_HPP
 
 #include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/block_view.hpp>
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/chain/chain_state.hpp>
 #include <bitcoin/system/chain/checkpoint.hpp>
 #include <bitcoin/system/chain/compact.hpp>
+#include <bitcoin/system/chain/compact_transaction.hpp>
 #include <bitcoin/system/chain/context.hpp>
 #include <bitcoin/system/chain/enums/coverage.hpp>
 #include <bitcoin/system/chain/enums/flags.hpp>
@@ -35,14 +37,19 @@
 #include <bitcoin/system/chain/enums/script_pattern.hpp>
 #include <bitcoin/system/chain/enums/script_version.hpp>
 #include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/headers_view.hpp>
+#include <bitcoin/system/chain/history.hpp>
 #include <bitcoin/system/chain/input.hpp>
 #include <bitcoin/system/chain/operation.hpp>
 #include <bitcoin/system/chain/output.hpp>
 #include <bitcoin/system/chain/point.hpp>
 #include <bitcoin/system/chain/prevout.hpp>
 #include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/script_cache.hpp>
+#include <bitcoin/system/chain/script_pool.hpp>
 #include <bitcoin/system/chain/stripper.hpp>
 #include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/transaction_view.hpp>
 #include <bitcoin/system/chain/witness.hpp>
 
 // Byte copy cost is computed as ceilinged divide of total member bits by 8 (128 bits per shared_ptr).
@@ -19,11 +19,11 @@
 #ifndef LIBBITCOIN_SYSTEM_CHAIN_CHAIN_STATE_HPP
 #define LIBBITCOIN_SYSTEM_CHAIN_CHAIN_STATE_HPP
 
-#include <deque>
 #include <memory>
 #include <bitcoin/system/chain/checkpoint.hpp>
 #include <bitcoin/system/chain/context.hpp>
 #include <bitcoin/system/chain/enums/flags.hpp>
+#include <bitcoin/system/chain/history.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/forks.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -46,9 +46,10 @@ class BC_API chain_state
 public:
     DELETE_COPY_MOVE_DESTRUCT(chain_state);
 
-    typedef std::deque<uint32_t> bitss;
-    typedef std::deque<uint32_t> versions;
-    typedef std::deque<uint32_t> timestamps;
+    /// Histories share structure, so child state derivation is O(1).
+    typedef chain::history bitss;
+    typedef chain::history versions;
+    typedef chain::history timestamps;
     typedef std::shared_ptr<chain_state> ptr;
     typedef struct { size_t count; size_t high; } range;
 
@@ -102,8 +103,8 @@ public:
         /// Hash of the bip9_bit1 block or null_hash if unrequested.
         hash_digest bip9_bit1_hash{};
 
-        /// Sum of all work from genesis to block height.
-        uint256_t cumulative_work{};
+        /// Sum of all work from genesis to block height (fixed-width limbs).
+        uint256 cumulative_work{};
 
         /// Values must be ordered by height with high (block - 1) last.
         struct
@@ -175,7 +176,7 @@ public:
     /// Properties.
     chain::context context() const NOEXCEPT;
     const hash_digest& hash() const NOEXCEPT;
-    const uint256_t& cumulative_work() const NOEXCEPT;
+    uint256_t cumulative_work() const NOEXCEPT;
     uint32_t minimum_block_version() const NOEXCEPT;
     uint32_t work_required() const NOEXCEPT;
     uint32_t timestamp() const NOEXCEPT;
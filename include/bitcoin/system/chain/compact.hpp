@@ -44,6 +44,9 @@ public:
     /// Non-minimal exponent encoding allowed only for mantissa sign bug.
     static constexpr span_type expand(small_type exponential) NOEXCEPT;
 
+    /// Identical to expand, computed over fixed-width limbs (not uintx_t).
+    static constexpr uint256 expand_fixed(small_type exponential) NOEXCEPT;
+
     /// (m * 256^e) bit-encoded as [0eeeeee][mmmmmmmm][mmmmmmmm][mmmmmmmm].
     /// Uses non-minimal exponent encoding to avoid mantissa sign (bug).
     static constexpr small_type compress(const span_type& number) NOEXCEPT;
@@ -60,6 +63,7 @@ protected:
 
     static constexpr parse to_compact(small_type small) NOEXCEPT;
     static constexpr small_type from_compact(const parse& compact) NOEXCEPT;
+    static constexpr small_type normalize(small_type small) NOEXCEPT;
 };
 
 } // namespace chain
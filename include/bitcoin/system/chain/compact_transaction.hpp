@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_COMPACT_TRANSACTION_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_COMPACT_TRANSACTION_HPP
+
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/prevout.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Transaction held in one allocation, with inputs and outputs stored as
+/// fixed-width arrays (struct of arrays) and all scripts, witnesses and
+/// populated prevout scripts in a single trailing byte pool. A transaction
+/// otherwise allocates a point, script and witness (and a shared input) per
+/// input, and a script (and a shared output) per output. Element access is
+/// by position and does not allocate. Positions must be within bounds.
+/// This is a storage form, scripts are not evaluated from it. Validation and
+/// connection require the materialized transaction (to_transaction).
+class BC_API compact_transaction
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(compact_transaction);
+
+    /// Default instance is an invalid (empty) object.
+    compact_transaction() NOEXCEPT;
+
+    /// Populated prevouts (value and script) and input prevout metadata
+    /// (height, median time past, spent, coinbase) are retained.
+    compact_transaction(const transaction& tx) NOEXCEPT;
+
+    /// Operators.
+    /// -----------------------------------------------------------------------
+
+    bool operator==(const compact_transaction& other) const NOEXCEPT;
+    bool operator!=(const compact_transaction& other) const NOEXCEPT;
+
+    /// Serialization.
+    /// -----------------------------------------------------------------------
+
+    data_chunk to_data(bool witness) const NOEXCEPT;
+    void to_data(writer& sink, bool witness) const NOEXCEPT;
+
+    /// Properties.
+    /// -----------------------------------------------------------------------
+
+    bool is_valid() const NOEXCEPT;
+    bool is_segregated() const NOEXCEPT;
+    bool is_coinbase() const NOEXCEPT;
+    size_t serialized_size(bool witness) const NOEXCEPT;
+
+    /// Bytes of the single allocation.
+    size_t allocation() const NOEXCEPT;
+
+    uint32_t version() const NOEXCEPT;
+    uint32_t locktime() const NOEXCEPT;
+    size_t inputs() const NOEXCEPT;
+    size_t outputs() const NOEXCEPT;
+
+    /// Input elements.
+    chain::point point(size_t input) const NOEXCEPT;
+    data_slice point_hash(size_t input) const NOEXCEPT;
+    uint32_t point_index(size_t input) const NOEXCEPT;
+    uint32_t sequence(size_t input) const NOEXCEPT;
+    data_slice input_script(size_t input) const NOEXCEPT;
+
+    /// Prefixed witness serialization, empty if there is no witness.
+    data_slice witness(size_t input) const NOEXCEPT;
+
+    /// Prevout elements, value and script are empty if not populated.
+    bool is_populated(size_t input) const NOEXCEPT;
+    uint64_t prevout_value(size_t input) const NOEXCEPT;
+    data_slice prevout_script(size_t input) const NOEXCEPT;
+
+    /// Prevout metadata of the input (retained whether or not populated).
+    chain::prevout metadata(size_t input) const NOEXCEPT;
+
+    /// Output elements.
+    uint64_t value(size_t output) const NOEXCEPT;
+    data_slice output_script(size_t output) const NOEXCEPT;
+
+    /// Sum of output values (ceilinged), as transaction::claim().
+    uint64_t claim() const NOEXCEPT;
+
+    /// Witness hash of a segregated coinbase is null_hash (bip141).
+    hash_digest hash(bool witness) const NOEXCEPT;
+
+    /// Materialize the transaction (with populated prevouts and metadata).
+    chain::transaction to_transaction() const NOEXCEPT;
+
+private:
+    size_t spans() const NOEXCEPT;
+    size_t sequences_offset() const NOEXCEPT;
+    size_t prevouts_offset() const NOEXCEPT;
+    size_t heights_offset() const NOEXCEPT;
+    size_t times_offset() const NOEXCEPT;
+    size_t populated_offset() const NOEXCEPT;
+    size_t values_offset() const NOEXCEPT;
+    size_t spans_offset() const NOEXCEPT;
+    size_t pool_offset() const NOEXCEPT;
+    data_slice span(size_t index) const NOEXCEPT;
+
+    // Inputs, outputs and pool, in one buffer.
+    data_chunk data_;
+
+    uint32_t version_;
+    uint32_t locktime_;
+    uint32_t inputs_;
+    uint32_t outputs_;
+    bool segregated_;
+    bool valid_;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
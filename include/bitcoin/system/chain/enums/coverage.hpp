@@ -30,6 +30,10 @@ namespace chain {
 /// Comments from: bitcoin.org/en/developer-guide#standard-transactions
 enum coverage : uint8_t
 {
+    /// The taproot default, signs as hash_all but without a trailing sighash
+    /// byte in the signature (bip341).
+    hash_default = 0,
+
     /// The default, signs all the inputs and outputs, protecting everything
     /// except the signature scripts against modification.
     hash_all = bit_right<uint8_t>(0),
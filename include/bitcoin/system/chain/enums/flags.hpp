@@ -128,6 +128,13 @@ enum flags : uint32_t
     /// Reduces threshold segregated witness signaling (soft fork, feature).
     bip91_rule = bit_right<uint32_t>(26),
 
+    /// Segregated witness v1 (taproot) key path verification (soft fork,
+    /// feature). Schnorr (bip340) key path signatures are verified and script
+    /// path spends are rejected, as tapscript (bip342) is not implemented.
+    /// This is not the full consensus rule, must not be used to validate the
+    /// chain, and is excluded from all_rules until tapscript is implemented.
+    bip341_rule = bit_right<uint32_t>(27),
+
     /// Agregates
     /// -----------------------------------------------------------------------
 
@@ -153,8 +160,9 @@ enum flags : uint32_t
     ////bip9_bit4_group =
     ////    flags::bip91_rule,
 
-    /// Mask to set all rule bits.
-    all_rules = bit_all<uint32_t>
+    /// Mask to set all rule bits, excluding the incomplete bip341_rule.
+    all_rules = bit_and<uint32_t>(bit_all<uint32_t>,
+        bit_not<uint32_t>(flags::bip341_rule))
 };
 
 } // namespace chain
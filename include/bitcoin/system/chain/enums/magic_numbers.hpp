@@ -83,6 +83,12 @@ constexpr uint32_t witness_head = 0xaa21a9ed;
 constexpr uint8_t witness_marker = 0x00;
 constexpr uint8_t witness_enabled = 0x01;
 
+/// Taproot consensus constants (bip341).
+/// ---------------------------------------------------------------------------
+
+constexpr uint8_t taproot_annex = 0x50;
+constexpr uint8_t taproot_sighash_epoch = 0x00;
+
 /// Policy constants.
 /// ---------------------------------------------------------------------------
 
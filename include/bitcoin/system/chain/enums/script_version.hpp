@@ -31,6 +31,9 @@ enum class script_version
     /// Defined by bip141. 
     zero,
 
+    /// Defined by bip341 (32 byte program, otherwise reserved).
+    one,
+
     /// All reserved script versions (1..16).
     reserved,
 
@@ -43,6 +43,7 @@ public:
     typedef std::shared_ptr<const header> cptr;
 
     static uint256_t proof(uint32_t bits) NOEXCEPT;
+    static uint256 proof_fixed(uint32_t bits) NOEXCEPT;
     static constexpr size_t serialized_size() NOEXCEPT
     {
         return sizeof(version_)
@@ -73,6 +74,8 @@ public:
     header(std::istream& stream) NOEXCEPT;
     header(reader&& source) NOEXCEPT;
     header(reader& source) NOEXCEPT;
+    header(read::bytes::fast&& source) NOEXCEPT;
+    header(read::bytes::fast& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -140,7 +143,8 @@ protected:
     // error::incorrect_proof_of_work
 
 private:
-    void assign_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source) NOEXCEPT;
 
     // Header should be stored as shared (adds 16 bytes).
     // copy: 4 * 32 + 2 * 256 + 1 = 81 bytes (vs. 16 when shared).
@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_HEADERS_VIEW_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_HEADERS_VIEW_HPP
+
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// View of contiguous wire-serialized headers (without transaction counts).
+/// Non-owning, the viewed buffer must outlive the view.
+class BC_API headers_view
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(headers_view);
+
+    /// Default view is a valid empty object.
+    headers_view() NOEXCEPT;
+
+    /// Data must be a whole number of headers (otherwise invalid).
+    headers_view(const data_slice& data) NOEXCEPT;
+
+    /// Properties.
+    /// -----------------------------------------------------------------------
+
+    bool is_valid() const NOEXCEPT;
+    size_t size() const NOEXCEPT;
+    bool empty() const NOEXCEPT;
+
+    /// Header at position (position must be less than size).
+    chain::header header(size_t position) const NOEXCEPT;
+
+    /// Header hashes in order, computed across vector lanes (as available).
+    system::hashes hashes() const NOEXCEPT;
+
+    /// Materialize the headers, with hashes cached.
+    chain::headers to_headers() const NOEXCEPT;
+
+    /// Validation.
+    /// -----------------------------------------------------------------------
+
+    /// Check linkage (the first header to previous) and header::check rules.
+    /// Returns the position of the first invalid header (with ec set to its
+    /// error), or size() with ec set to success. An invalid view returns zero
+    /// with ec set to error::orphan_block.
+    size_t check(code& ec, const hash_digest& previous,
+        uint32_t timestamp_limit_seconds, uint32_t proof_of_work_limit,
+        bool scrypt=false) const NOEXCEPT;
+
+private:
+    data_slice data_;
+    bool valid_;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_HISTORY_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_HISTORY_HPP
+
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Bounded window over a shared, append-only buffer of header values.
+/// Copies share the buffer, so a child chain state copies its parent window
+/// in constant time. Appending to the newest window over a buffer writes in
+/// place, as older windows do not extend over the appended value. Appending
+/// to any other window (a fork), or to a full buffer, first copies the window
+/// to a new buffer of twice its size, so appends are amortized constant time.
+/// Distinct windows may be appended concurrently, a window may not.
+class BC_API history final
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(history);
+
+    typedef uint32_t value_type;
+    typedef const uint32_t* const_iterator;
+    typedef const_iterator iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef const_reverse_iterator reverse_iterator;
+
+    /// Default history is empty and unallocated.
+    history() NOEXCEPT;
+
+    /// Append a value (to the window).
+    void push_back(uint32_t value) NOEXCEPT;
+
+    /// Remove the oldest value from the window (window must not be empty).
+    void pop_front() NOEXCEPT;
+
+    /// Properties.
+    bool empty() const NOEXCEPT;
+    size_t size() const NOEXCEPT;
+    uint32_t front() const NOEXCEPT;
+    uint32_t back() const NOEXCEPT;
+
+    /// Iteration (oldest first).
+    const_iterator begin() const NOEXCEPT;
+    const_iterator end() const NOEXCEPT;
+    const_reverse_iterator rbegin() const NOEXCEPT;
+    const_reverse_iterator rend() const NOEXCEPT;
+    const_reverse_iterator crbegin() const NOEXCEPT;
+    const_reverse_iterator crend() const NOEXCEPT;
+
+    /// Windows are equal if their values are equal.
+    bool operator==(const history& other) const NOEXCEPT;
+    bool operator!=(const history& other) const NOEXCEPT;
+
+private:
+    struct buffer
+    {
+        buffer(size_t capacity, size_t size) NOEXCEPT;
+
+        // Values at or above size are not visible to any window.
+        std::vector<uint32_t> values;
+        std::atomic<size_t> size;
+    };
+
+    bool claim() NOEXCEPT;
+    void reallocate() NOEXCEPT;
+
+    std::shared_ptr<buffer> buffer_;
+    size_t begin_;
+    size_t end_;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -27,6 +27,7 @@
 #include <bitcoin/system/chain/point.hpp>
 #include <bitcoin/system/chain/prevout.hpp>
 #include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/script_pool.hpp>
 #include <bitcoin/system/chain/witness.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -74,6 +75,11 @@ public:
     input(std::istream& stream) NOEXCEPT;
     input(reader&& source) NOEXCEPT;
     input(reader& source) NOEXCEPT;
+    input(read::bytes::fast&& source) NOEXCEPT;
+    input(read::bytes::fast& source) NOEXCEPT;
+
+    /// Script is shared through the pool.
+    input(reader& source, script_pool& pool) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -137,6 +143,8 @@ private:
     size_t nominal_size() const NOEXCEPT;
     size_t witnessed_size() const NOEXCEPT;
     void set_witness(reader& source) NOEXCEPT;
+    void set_witness(read::bytes::fast& source) NOEXCEPT;
+    void set_witness(reader& source, script_pool& pool) NOEXCEPT;
 
     const chain::witness& get_witness() const NOEXCEPT;
     const chain::witness::cptr& get_witness_cptr() const NOEXCEPT;
@@ -91,6 +91,8 @@ public:
     operation(std::istream& stream) NOEXCEPT;
     operation(reader&& source) NOEXCEPT;
     operation(reader& source) NOEXCEPT;
+    operation(read::bytes::fast&& source) NOEXCEPT;
+    operation(read::bytes::fast& source) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     // TODO: a byte-deserialized operation cannot be invalid unless empty.
@@ -156,7 +158,8 @@ protected:
 private:
     // So script may call count_op.
     friend class script;
-    static bool count_op(reader& source) NOEXCEPT;
+    template <typename Source>
+    static inline bool count_op(Source& source) NOEXCEPT;
 
     static operation from_push_data(const chunk_cptr& data,
         bool minimal) NOEXCEPT;
@@ -167,7 +170,9 @@ private:
     static const data_chunk& no_data() NOEXCEPT;
     static const chunk_cptr& no_data_cptr() NOEXCEPT;
     static const chunk_cptr& any_data_cptr() NOEXCEPT;
-    static uint32_t read_data_size(opcode code, reader& source) NOEXCEPT;
+    template <typename Source>
+    static inline uint32_t read_data_size(opcode code,
+        Source& source) NOEXCEPT;
     static inline opcode opcode_from_data(const data_chunk& push_data,
         bool minimal) NOEXCEPT
     {
@@ -179,7 +184,8 @@ private:
     size_t data_size() const NOEXCEPT;
     const data_chunk& get_data() const NOEXCEPT;
     const chunk_cptr& get_data_cptr() const NOEXCEPT;
-    void assign_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source) NOEXCEPT;
 
     // Operation should not be stored as shared (adds 16 bytes).
     // copy: 8 + 2 * 64 + 1 = 18 bytes (vs. 16 when shared).
@@ -23,6 +23,7 @@
 #include <memory>
 #include <vector>
 #include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/script_pool.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 
@@ -57,6 +58,11 @@ public:
     output(std::istream& stream) NOEXCEPT;
     output(reader&& source) NOEXCEPT;
     output(reader& source) NOEXCEPT;
+    output(read::bytes::fast&& source) NOEXCEPT;
+    output(read::bytes::fast& source) NOEXCEPT;
+
+    /// Script is shared through the pool.
+    output(reader& source, script_pool& pool) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -95,7 +101,8 @@ protected:
         bool valid) NOEXCEPT;
 
 private:
-    void assign_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source) NOEXCEPT;
     static size_t serialized_size(const chain::script& script,
         uint64_t value) NOEXCEPT;
 
@@ -63,6 +63,8 @@ public:
     point(std::istream& stream) NOEXCEPT;
     point(reader&& source) NOEXCEPT;
     point(reader& source) NOEXCEPT;
+    point(read::bytes::fast&& source) NOEXCEPT;
+    point(read::bytes::fast& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -93,7 +95,8 @@ protected:
     point(const hash_digest& hash, uint32_t index, bool valid) NOEXCEPT;
 
 private:
-    void assign_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source) NOEXCEPT;
 
     // The index is consensus-serialized as a fixed 4 bytes, however it is
     // effectively bound to 2^17 by the block byte size limit.
@@ -109,6 +109,8 @@ public:
     script(std::istream& stream, bool prefix) NOEXCEPT;
     script(reader&& source, bool prefix) NOEXCEPT;
     script(reader& source, bool prefix) NOEXCEPT;
+    script(read::bytes::fast&& source, bool prefix) NOEXCEPT;
+    script(read::bytes::fast& source, bool prefix) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     script(const std::string& mnemonic) NOEXCEPT;
@@ -175,14 +177,16 @@ private:
     // TODO: move to config serialization wrapper.
     static script from_string(const std::string& mnemonic) NOEXCEPT;
 
-    static size_t op_count(reader& source) NOEXCEPT;
+    template <typename Source>
+    static size_t op_count(Source& source) NOEXCEPT;
     static size_t serialized_size(const operations& ops) NOEXCEPT;
     static inline size_t op_size(size_t total, const operation& op) NOEXCEPT
     {
         return ceilinged_add(total, op.serialized_size());
     };
 
-    void assign_data(reader& source, bool prefix) NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source, bool prefix) NOEXCEPT;
 
     // Script should be stored as shared.
     operations ops_;
@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_SCRIPT_CACHE_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_SCRIPT_CACHE_HPP
+
+#include <atomic>
+#include <shared_mutex>
+#include <unordered_set>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Thread safe, bounded set of successful input script connections, keyed
+/// by (witness tx hash, input index, active flags). The witness hash commits
+/// to input scripts, witnesses and prevout points, and flags to the rules.
+/// Failures are not cached. Oldest entries are evicted once at capacity.
+class BC_API script_cache final
+{
+public:
+    DELETE_COPY_MOVE(script_cache);
+
+    /// Zero capacity disables caching (all queries miss).
+    script_cache(size_t capacity) NOEXCEPT;
+
+    /// True if the input connection is cached (counts hit or miss).
+    bool find(const hash_digest& hash, uint32_t index,
+        uint32_t flags) const NOEXCEPT;
+
+    /// Cache a successful input connection.
+    void store(const hash_digest& hash, uint32_t index,
+        uint32_t flags) NOEXCEPT;
+
+    /// Remove all entries (counters are retained).
+    void clear() NOEXCEPT;
+
+    /// Properties.
+    size_t size() const NOEXCEPT;
+    size_t capacity() const NOEXCEPT;
+    size_t hits() const NOEXCEPT;
+    size_t misses() const NOEXCEPT;
+
+private:
+    struct key
+    {
+        hash_digest hash;
+        uint32_t index;
+        uint32_t flags;
+
+        bool operator==(const key& other) const NOEXCEPT
+        {
+            return index == other.index && flags == other.flags &&
+                hash == other.hash;
+        }
+    };
+
+    struct key_hash
+    {
+        size_t operator()(const key& value) const NOEXCEPT
+        {
+            return hash_combine(unique_hash(value.hash),
+                hash_combine(value.index, value.flags));
+        }
+    };
+
+    // These are thread safe.
+    const size_t capacity_;
+    mutable std::atomic<size_t> hits_{};
+    mutable std::atomic<size_t> misses_{};
+
+    // These are protected by mutex.
+    std::unordered_set<key, key_hash> set_{};
+    std_vector<key> order_{};
+    size_t next_{};
+    mutable std::shared_mutex mutex_{};
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
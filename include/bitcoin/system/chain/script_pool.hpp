@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_SCRIPT_POOL_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_SCRIPT_POOL_HPP
+
+#include <atomic>
+#include <deque>
+#include <shared_mutex>
+#include <unordered_map>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Thread safe, bounded interning pool of immutable scripts and witnesses,
+/// keyed by serialization. Deserialization through a pool shares one
+/// instance of each repeated script (e.g. p2pkh/p2wpkh templates, multisig).
+/// Pooled instances are heap allocated, as they outlive any reader arena.
+/// Pooled bytes are the approximate heap footprint of each entry (key, map
+/// node, instance and its elements). Oldest entries are evicted once pooled
+/// bytes would exceed capacity, and an evicted instance remains valid for as
+/// long as it is referenced.
+class BC_API script_pool final
+{
+public:
+    DELETE_COPY_MOVE(script_pool);
+
+    /// Scripts/witnesses over the limit (bytes) are read but never pooled.
+    static constexpr size_t default_limit = 520;
+
+    /// Capacity is the maximum pooled bytes (zero disables pooling).
+    /// Limit is compared to serialized size, excluding any size prefix.
+    script_pool(size_t capacity, size_t limit=default_limit) NOEXCEPT;
+
+    /// Read a size-prefixed script, shared if pooled (counts hit or miss).
+    script::cptr intern_script(reader& source) NOEXCEPT;
+
+    /// Read a size-prefixed witness, shared if pooled (counts hit or miss).
+    witness::cptr intern_witness(reader& source) NOEXCEPT;
+
+    /// Approximate heap bytes of a pooled entry.
+    static size_t footprint(const data_chunk& key,
+        const script& instance) NOEXCEPT;
+    static size_t footprint(const data_chunk& key,
+        const witness& instance) NOEXCEPT;
+
+    /// Remove all entries (counters are retained).
+    void clear() NOEXCEPT;
+
+    /// Properties.
+    size_t size() const NOEXCEPT;
+    size_t bytes() const NOEXCEPT;
+    size_t capacity() const NOEXCEPT;
+    size_t limit() const NOEXCEPT;
+    size_t hits() const NOEXCEPT;
+    size_t misses() const NOEXCEPT;
+
+private:
+    using scripts = std::unordered_map<data_chunk, script::cptr>;
+    using witnesses = std::unordered_map<data_chunk, witness::cptr>;
+
+    // Map keys are node-based, so their addresses are stable until erased.
+    struct entry
+    {
+        const data_chunk* key;
+        size_t size;
+        bool witness;
+    };
+
+    template <typename Map>
+    typename Map::mapped_type find(const Map& map,
+        const data_chunk& key) const NOEXCEPT;
+    template <typename Map>
+    typename Map::mapped_type store(Map& map, data_chunk&& key,
+        const typename Map::mapped_type& value, bool witness) NOEXCEPT;
+    void evict() NOEXCEPT;
+
+    // These are thread safe.
+    const size_t capacity_;
+    const size_t limit_;
+    mutable std::atomic<size_t> hits_{};
+    mutable std::atomic<size_t> misses_{};
+
+    // These are protected by mutex.
+    scripts scripts_{};
+    witnesses witnesses_{};
+    std::deque<entry> order_{};
+    size_t bytes_{};
+    mutable std::shared_mutex mutex_{};
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -27,6 +27,8 @@
 #include <bitcoin/system/chain/input.hpp>
 #include <bitcoin/system/chain/output.hpp>
 #include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/script_cache.hpp>
+#include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -53,6 +55,10 @@ public:
     static hash_digest desegregated_hash(size_t witnessed,
         size_t unwitnessed, const uint8_t* data) NOEXCEPT;
 
+    /// Copy non-witness serialization (unwitnessed bytes) from witness data.
+    static void desegregate(uint8_t* out, size_t witnessed,
+        size_t unwitnessed, const uint8_t* data) NOEXCEPT;
+
     /// Constructors.
     /// -----------------------------------------------------------------------
 
@@ -73,6 +79,11 @@ public:
     transaction(std::istream& stream, bool witness) NOEXCEPT;
     transaction(reader&& source, bool witness) NOEXCEPT;
     transaction(reader& source, bool witness) NOEXCEPT;
+    transaction(read::bytes::fast&& source, bool witness) NOEXCEPT;
+    transaction(read::bytes::fast& source, bool witness) NOEXCEPT;
+
+    /// Scripts and witnesses are shared through the pool.
+    transaction(reader& source, bool witness, script_pool& pool) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -122,6 +133,9 @@ public:
     /// Reference used to avoid copy, sets cache if not set (not thread safe).
     const hash_digest& get_hash(bool witness) const NOEXCEPT;
 
+    /// Set signature hash cache, required before concurrent input connect.
+    void initialize_sighash_cache() const NOEXCEPT;
+
     /// Methods.
     /// -----------------------------------------------------------------------
 
@@ -136,6 +150,11 @@ public:
         uint64_t value, uint8_t sighash_flags, script_version version,
         bool bip143) const NOEXCEPT;
 
+    /// Key path signature hash (bip341), false if sighash flags are invalid.
+    /// Requires populated prevouts for all inputs.
+    bool signature_hash(hash_digest& out, const input_iterator& input,
+        uint8_t sighash_flags) const NOEXCEPT;
+
     bool check_signature(const ec_signature& signature,
         const data_slice& public_key, const script& sub, uint32_t index,
         uint64_t value, uint8_t sighash_flags, script_version version,
@@ -162,6 +181,17 @@ public:
     code connect(const context& ctx) const NOEXCEPT;
     code confirm(const context& ctx) const NOEXCEPT;
 
+    /// Connect one input, thread safe given initialized sighash cache.
+    code connect_input(const context& ctx,
+        const input_iterator& input) const NOEXCEPT;
+
+    /// Connect with terminal signature checks deferred into batch. Success
+    /// is conditional upon subsequent verify_signatures(batch) success.
+    code connect(const context& ctx, signature_batch& batch) const NOEXCEPT;
+
+    /// Connect inputs not found in cache, caching those that succeed.
+    code connect(const context& ctx, script_cache& cache) const NOEXCEPT;
+
 protected:
     transaction(uint32_t version, const chain::inputs_cptr& inputs,
         const chain::outputs_cptr& outputs, uint32_t locktime, bool segregated,
@@ -227,17 +257,37 @@ private:
     typedef struct { size_t nominal; size_t witnessed; } sizes;
     typedef struct
     {
+        // Double hashes (bip143).
         hash_digest outputs;
         hash_digest points;
         hash_digest sequences;
+
+        // Single hashes (bip341), amounts and scripts require prevouts.
+        hash_digest single_outputs;
+        hash_digest single_points;
+        hash_digest single_sequences;
+        hash_digest amounts;
+        hash_digest scripts;
+        bool prevouts;
     } sighash_cache;
+    typedef std::vector<sha256::state_t> midstates;
+    typedef struct
+    {
+        size_t inputs;
+        data_chunk all;
+        data_chunk none;
+        midstates all_states;
+        midstates none_states;
+    } unversioned_cache;
 
     static bool segregated(const chain::inputs& inputs) NOEXCEPT;
     static bool segregated(const chain::input_cptrs& inputs) NOEXCEPT;
     static sizes serialized_size(const chain::input_cptrs& inputs,
         const chain::output_cptrs& outputs, bool segregated) NOEXCEPT;
 
-    void assign_data(reader& source, bool witness) NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source, bool witness,
+        script_pool* pool=nullptr) NOEXCEPT;
 
     // signature hash
     hash_digest output_hash(const input_iterator& input) const NOEXCEPT;
@@ -251,16 +301,35 @@ private:
         const script& sub, uint8_t sighash_flags) const NOEXCEPT;
     hash_digest unversioned_signature_hash(const input_iterator& input,
         const script& sub, uint8_t sighash_flags) const NOEXCEPT;
+    hash_digest cached_signature_hash(const input_iterator& input,
+        const script& sub, uint8_t sighash_flags) const NOEXCEPT;
     hash_digest version_0_signature_hash(const input_iterator& input,
         const script& sub, uint64_t value, uint8_t sighash_flags,
         bool bip143) const NOEXCEPT;
+    hash_digest version_1_signature_hash(const input_iterator& input,
+        uint8_t sighash_flags) const NOEXCEPT;
+
+    // Connect (template fast path, true only if verified).
+    bool connect_template(const context& ctx,
+        const input_iterator& input) const NOEXCEPT;
+    bool connect_witness_key_hash(const context& ctx,
+        const input_iterator& input, const data_chunk& program) const NOEXCEPT;
+    bool connect_key_hash(const input_iterator& input,
+        const data_chunk& endorsement, const data_chunk& key,
+        const short_hash& hash, const script& sub, uint64_t value,
+        script_version version, uint32_t active_flags) const NOEXCEPT;
 
     // Caching.
     chain::points points() const NOEXCEPT;
     hash_digest outputs_hash() const NOEXCEPT;
     hash_digest points_hash() const NOEXCEPT;
     hash_digest sequences_hash() const NOEXCEPT;
-    void initialize_sighash_cache() const NOEXCEPT;
+    hash_digest single_outputs_hash() const NOEXCEPT;
+    hash_digest single_points_hash() const NOEXCEPT;
+    hash_digest single_sequences_hash() const NOEXCEPT;
+    hash_digest amounts_hash() const NOEXCEPT;
+    hash_digest scripts_hash() const NOEXCEPT;
+    unversioned_cache unversioned_preimages() const NOEXCEPT;
 
     // Transaction should be stored as shared (adds 16 bytes).
     // copy: 5 * 64 + 2 = 41 bytes (vs. 16 when shared).
@@ -278,6 +347,7 @@ private:
     mutable std::optional<hash_digest> nominal_hash_{};
     mutable std::optional<hash_digest> witness_hash_{};
     mutable std::optional<sighash_cache> sighash_cache_{};
+    mutable std::optional<unversioned_cache> unversioned_cache_{};
 };
 
 typedef std_vector<transaction> transactions;
@@ -0,0 +1,254 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_TRANSACTION_VIEW_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_TRANSACTION_VIEW_HPP
+
+#include <iterator>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Views are non-owning and non-allocating. The viewed buffer must outlive
+/// the view and any views obtained from it. Structure is validated on view
+/// construction, so element access over a valid view does not fail.
+
+/// Forward range over a known number of contiguously-serialized elements.
+template <typename View>
+class view_range
+{
+public:
+    class iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = View;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const View*;
+        using reference = const View&;
+
+        iterator(const data_slice& data, size_t remaining) NOEXCEPT
+          : data_(data),
+            remaining_(remaining),
+            view_(is_zero(remaining) ? View{} : View{ data })
+        {
+        }
+
+        reference operator*() const NOEXCEPT
+        {
+            return view_;
+        }
+
+        pointer operator->() const NOEXCEPT
+        {
+            return &view_;
+        }
+
+        iterator& operator++() NOEXCEPT
+        {
+            *this = { advance(), sub1(remaining_) };
+            return *this;
+        }
+
+        iterator operator++(int) NOEXCEPT
+        {
+            auto self = *this;
+            ++(*this);
+            return self;
+        }
+
+        bool operator==(const iterator& other) const NOEXCEPT
+        {
+            return remaining_ == other.remaining_;
+        }
+
+        bool operator!=(const iterator& other) const NOEXCEPT
+        {
+            return !(*this == other);
+        }
+
+    private:
+        data_slice advance() const NOEXCEPT
+        {
+            BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+            return { std::next(data_.begin(), view_.data().size()),
+                data_.end() };
+            BC_POP_WARNING()
+        }
+
+        data_slice data_;
+        size_t remaining_;
+        View view_;
+    };
+
+    /// Data begins at the first element and bounds the last.
+    view_range(const data_slice& data, size_t count) NOEXCEPT
+      : data_(data), count_(count)
+    {
+    }
+
+    size_t size() const NOEXCEPT
+    {
+        return count_;
+    }
+
+    bool empty() const NOEXCEPT
+    {
+        return is_zero(count_);
+    }
+
+    iterator begin() const NOEXCEPT
+    {
+        return { data_, count_ };
+    }
+
+    iterator end() const NOEXCEPT
+    {
+        return { data_, zero };
+    }
+
+private:
+    data_slice data_;
+    size_t count_;
+};
+
+/// View of a wire-serialized input (excluding witness).
+class BC_API input_view
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(input_view);
+
+    /// Default view is an invalid (empty) object.
+    input_view() NOEXCEPT;
+
+    /// Data begins at the input, trailing bytes are not viewed.
+    input_view(const data_slice& data) NOEXCEPT;
+
+    bool is_valid() const NOEXCEPT;
+    size_t serialized_size() const NOEXCEPT;
+
+    chain::point point() const NOEXCEPT;
+    uint32_t point_index() const NOEXCEPT;
+    data_slice point_hash() const NOEXCEPT;
+    data_slice script() const NOEXCEPT;
+    uint32_t sequence() const NOEXCEPT;
+
+    /// Viewed wire serialization.
+    data_slice data() const NOEXCEPT;
+
+    /// Materialize the input (without witness).
+    chain::input to_input() const NOEXCEPT;
+
+private:
+    data_slice data_;
+    size_t script_;
+    bool valid_;
+};
+
+/// View of a wire-serialized output.
+class BC_API output_view
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(output_view);
+
+    /// Default view is an invalid (empty) object.
+    output_view() NOEXCEPT;
+
+    /// Data begins at the output, trailing bytes are not viewed.
+    output_view(const data_slice& data) NOEXCEPT;
+
+    bool is_valid() const NOEXCEPT;
+    size_t serialized_size() const NOEXCEPT;
+
+    uint64_t value() const NOEXCEPT;
+    data_slice script() const NOEXCEPT;
+
+    /// Viewed wire serialization.
+    data_slice data() const NOEXCEPT;
+
+    /// Materialize the output.
+    chain::output to_output() const NOEXCEPT;
+
+private:
+    data_slice data_;
+    size_t script_;
+    bool valid_;
+};
+
+typedef view_range<input_view> input_views;
+typedef view_range<output_view> output_views;
+
+/// View of a wire-serialized transaction (with or without witness).
+class BC_API transaction_view
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(transaction_view);
+
+    /// Default view is an invalid (empty) object.
+    transaction_view() NOEXCEPT;
+
+    /// Data begins at the transaction, trailing bytes are not viewed.
+    transaction_view(const data_slice& data) NOEXCEPT;
+
+    /// Properties.
+    /// -----------------------------------------------------------------------
+
+    bool is_valid() const NOEXCEPT;
+    bool is_segregated() const NOEXCEPT;
+    bool is_coinbase() const NOEXCEPT;
+    size_t serialized_size(bool witness) const NOEXCEPT;
+
+    uint32_t version() const NOEXCEPT;
+    uint32_t locktime() const NOEXCEPT;
+    input_views inputs() const NOEXCEPT;
+    output_views outputs() const NOEXCEPT;
+
+    /// Witness hash of a segregated coinbase is null_hash (bip141).
+    hash_digest hash(bool witness) const NOEXCEPT;
+
+    /// Viewed wire serialization (witness as viewed).
+    data_slice data() const NOEXCEPT;
+
+    /// Materialize the transaction.
+    chain::transaction to_transaction(bool witness) const NOEXCEPT;
+
+private:
+    data_slice data_;
+    data_slice puts_;
+    size_t inputs_;
+    size_t outputs_;
+    size_t inputs_offset_;
+    size_t outputs_offset_;
+    size_t nominal_;
+    bool segregated_;
+    bool valid_;
+};
+
+typedef view_range<transaction_view> transaction_views;
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -62,6 +62,8 @@ public:
     witness(std::istream& stream, bool prefix) NOEXCEPT;
     witness(reader&& source, bool prefix) NOEXCEPT;
     witness(reader& source, bool prefix) NOEXCEPT;
+    witness(read::bytes::fast&& source, bool prefix) NOEXCEPT;
+    witness(read::bytes::fast& source, bool prefix) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     witness(const std::string& mnemonic) NOEXCEPT;
@@ -97,6 +99,7 @@ public:
 
     /// Skip a witness (as if deserialized).
     static void skip(reader& source, bool prefix) NOEXCEPT;
+    static void skip(read::bytes::fast& source, bool prefix) NOEXCEPT;
 
     static VCONSTEXPR bool is_push_size(const chunk_cptrs& stack) NOEXCEPT
     {
@@ -113,6 +116,13 @@ public:
         return is_one(stack.size()) && stack.front()->size() == hash_size;
     }
 
+    /// The last of two or more elements is an annex if so prefixed (bip341).
+    static VCONSTEXPR bool is_annex_pattern(const chunk_cptrs& stack) NOEXCEPT
+    {
+        return stack.size() > one && !stack.back()->empty() &&
+            stack.back()->front() == taproot_annex;
+    }
+
     bool extract_sigop_script(script& out_script,
         const script& program_script) const NOEXCEPT;
     bool extract_script(script::cptr& out_script, chunk_cptrs_ptr& out_stack,
@@ -140,7 +150,8 @@ private:
     BC_POP_WARNING()
     BC_POP_WARNING()
 
-    void assign_data(reader& source, bool prefix) NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source, bool prefix) NOEXCEPT;
 
     // Witness should be stored as shared.
     chunk_cptrs stack_;
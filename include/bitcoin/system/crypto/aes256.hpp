@@ -40,6 +40,25 @@ typedef data_array<secret_size> secret;
 void encrypt(block& bytes, const secret& key) NOEXCEPT;
 void decrypt(block& bytes, const secret& key) NOEXCEPT;
 
+/// Perform aes256 encryption/decryption on a sequence of data blocks.
+/// The key is expanded once and independent blocks are processed in parallel
+/// using aes-ni (and vaes) intrinsics when compiled and available at runtime.
+/// Data is transformed in place and is not padded, so ecb and cbc return
+/// false (without modifying data) if size is not a multiple of block_size.
+bool encrypt_ecb(const data_slab& bytes, const secret& key) NOEXCEPT;
+bool decrypt_ecb(const data_slab& bytes, const secret& key) NOEXCEPT;
+bool encrypt_cbc(const data_slab& bytes, const secret& key,
+    const block& iv) NOEXCEPT;
+bool decrypt_cbc(const data_slab& bytes, const secret& key,
+    const block& iv) NOEXCEPT;
+
+/// The ctr counter is a big-endian integer incremented for each block, and
+/// any size is accepted. Decryption is identical to encryption.
+void encrypt_ctr(const data_slab& bytes, const secret& key,
+    const block& counter) NOEXCEPT;
+void decrypt_ctr(const data_slab& bytes, const secret& key,
+    const block& counter) NOEXCEPT;
+
 } // namespace aes256
 } // namespace system
 } // namespace libbitcoin
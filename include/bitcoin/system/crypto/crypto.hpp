@@ -25,5 +25,6 @@
 #include <bitcoin/system/crypto/pseudo_random.hpp>
 #include <bitcoin/system/crypto/ring_signature.hpp>
 #include <bitcoin/system/crypto/secp256k1.hpp>
+#include <bitcoin/system/crypto/signature_cache.hpp>
 
 #endif
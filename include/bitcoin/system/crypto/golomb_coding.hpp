@@ -24,6 +24,7 @@
 
 #include <istream>
 #include <ostream>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -32,6 +33,9 @@ namespace libbitcoin {
 namespace system {
 namespace golomb {
 
+/// The sorted (hashed) values of a decoded golomb-coded set.
+typedef std::vector<uint64_t> decoded_set;
+
 // Golomb-coded set construction
 // ----------------------------------------------------------------------------
 
@@ -87,6 +91,29 @@ BC_API bool match(const data_stack& targets, std::istream& compressed_set,
     uint64_t set_size, const siphash_key& entropy, uint8_t bits,
     uint64_t target_false_positive_rate) NOEXCEPT;
 
+// Decoded set
+// ----------------------------------------------------------------------------
+// Decode once to match many targets against the same set without decoding
+// the set for each match. Returns empty set if the set cannot be decoded.
+
+BC_API decoded_set decode(const data_chunk& compressed_set,
+    uint64_t set_size, uint8_t bits) NOEXCEPT;
+
+BC_API decoded_set decode(std::istream& compressed_set, uint64_t set_size,
+    uint8_t bits) NOEXCEPT;
+
+BC_API bool match(const data_chunk& target, const decoded_set& set,
+    const half_hash& entropy, uint64_t target_false_positive_rate) NOEXCEPT;
+
+BC_API bool match(const data_chunk& target, const decoded_set& set,
+    const siphash_key& entropy, uint64_t target_false_positive_rate) NOEXCEPT;
+
+BC_API bool match(const data_stack& targets, const decoded_set& set,
+    const half_hash& entropy, uint64_t target_false_positive_rate) NOEXCEPT;
+
+BC_API bool match(const data_stack& targets, const decoded_set& set,
+    const siphash_key& entropy, uint64_t target_false_positive_rate) NOEXCEPT;
+
 } // namespace golomb
 } // namespace system
 } // namespace libbitcoin
@@ -46,7 +46,11 @@ static constexpr size_t ec_uncompressed_size = 65;
 typedef data_array<ec_uncompressed_size> ec_uncompressed;
 typedef std_vector<ec_uncompressed> uncompressed_list;
 
-// Parsed ECDSA signature:
+/// X-only public key (bip340):
+static constexpr size_t ec_xonly_size = 32;
+typedef data_array<ec_xonly_size> ec_xonly;
+
+// Parsed ECDSA signature (or BIP340 schnorr signature):
 static constexpr size_t ec_signature_size = 64;
 typedef data_array<ec_signature_size> ec_signature;
 
@@ -83,6 +87,26 @@ struct BC_API recoverable_signature
     uint8_t recovery_id;
 };
 
+/// Signature scheme of a deferred verification.
+enum class signature_kind : uint8_t
+{
+    ecdsa,
+    schnorr
+};
+
+/// Deferred signature verification (point, hash, signature). The scheme is set
+/// by the creator of the entry (never inferred from point size), so that a
+/// block may accumulate ecdsa and schnorr (bip340) entries in one batch.
+struct BC_API signature_entry
+{
+    data_chunk point;
+    hash_digest hash;
+    ec_signature signature;
+    signature_kind kind;
+};
+
+typedef std_vector<signature_entry> signature_batch;
+
 // Add EC values
 // ----------------------------------------------------------------------------
 
@@ -92,6 +116,10 @@ BC_API bool ec_add(ec_compressed& point, const ec_secret& scalar) NOEXCEPT;
 /// Compute the sum a += G * b.
 BC_API bool ec_add(ec_uncompressed& point, const ec_secret& scalar) NOEXCEPT;
 
+/// Compute the sums out[n] = a + G * b[n], with a parsed only once.
+BC_API bool ec_add(compressed_list& out, const ec_compressed& point,
+    const secret_list& scalars) NOEXCEPT;
+
 /// Compute the sum a = (a + b) % n.
 BC_API bool ec_add(ec_secret& left, const ec_secret& right) NOEXCEPT;
 
@@ -203,6 +231,42 @@ BC_API bool sign(ec_signature& out, const ec_secret& secret,
 BC_API bool verify_signature(const data_slice& point, const hash_digest& hash,
     const ec_signature& signature) NOEXCEPT;
 
+/// Cache successful verify_signature(s) results in a process-wide, salted,
+/// fixed memory set of the given entry capacity (disabled by default).
+/// Thread safe, the first non-zero capacity enables the cache for the life of
+/// the process and subsequent calls are ignored. This is the configuration
+/// API for the cache (there is no corresponding settings member), 32 bytes per
+/// entry.
+BC_API void set_signature_cache(size_t capacity) NOEXCEPT;
+
+/// Verify deferred EC (ecdsa and schnorr) signatures sequentially over a
+/// single context. This is not batch (multi-scalar) verification, each entry
+/// costs one full verification (less cache hits). Returns the index of the
+/// first entry that fails, or batch.size() if none.
+BC_API size_t verify_signatures(const signature_batch& batch) NOEXCEPT;
+
+// Schnorr sign/verify (bip340)
+// ----------------------------------------------------------------------------
+
+/// Convert secret to an x-only point.
+BC_API bool secret_to_xonly(ec_xonly& out, const ec_secret& secret) NOEXCEPT;
+
+/// Create a schnorr signature using a private key and auxiliary randomness.
+BC_API bool sign_schnorr(ec_signature& out, const ec_secret& secret,
+    const hash_digest& hash, const hash_digest& auxiliary={}) NOEXCEPT;
+
+/// Verify a schnorr signature using a potential x-only point.
+BC_API bool verify_schnorr(const data_slice& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT;
+
+/// Compute the x-only point out = point + G * tweak, and its parity (bip341).
+BC_API bool tweak_xonly(ec_xonly& out, bool& odd, const ec_xonly& point,
+    const hash_digest& tweak) NOEXCEPT;
+
+/// Verify that tweaked = point + G * tweak, with the given parity (bip341).
+BC_API bool verify_tweak(const ec_xonly& tweaked, bool odd,
+    const ec_xonly& point, const hash_digest& tweak) NOEXCEPT;
+
 // Recoverable sign/recover
 // ----------------------------------------------------------------------------
 
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CRYPTO_SIGNATURE_CACHE_HPP
+#define LIBBITCOIN_SYSTEM_CRYPTO_SIGNATURE_CACHE_HPP
+
+#include <array>
+#include <mutex>
+#include <bitcoin/system/crypto/secp256k1.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Thread safe, fixed memory set of successfully verified signatures.
+/// Entries are salted sha256 digests of (kind, hash, point, signature), so cache
+/// content cannot be targeted without knowledge of the random salt. Buckets
+/// are four-way associative and partitioned into independently locked shards
+/// so that concurrent validators rarely contend. Replacement is by rotation.
+class BC_API signature_cache final
+{
+public:
+    DELETE_COPY_MOVE(signature_cache);
+
+    /// Capacity is rounded down to a multiple of shards * ways (zero disables).
+    signature_cache(size_t capacity) NOEXCEPT;
+
+    /// True if the signature has been cached as verified.
+    bool contains(const data_slice& point, const hash_digest& hash,
+        const ec_signature& signature, signature_kind kind) const NOEXCEPT;
+
+    /// Cache a verified signature.
+    void insert(const data_slice& point, const hash_digest& hash,
+        const ec_signature& signature, signature_kind kind) NOEXCEPT;
+
+    /// Number of entries allocated.
+    size_t capacity() const NOEXCEPT;
+
+private:
+    static constexpr size_t shards = 64;
+    static constexpr size_t ways = 4;
+
+    struct shard
+    {
+        mutable std::mutex mutex{};
+        std_vector<hash_digest> slots{};
+        size_t rotation{};
+    };
+
+    hash_digest digest(const data_slice& point, const hash_digest& hash,
+        const ec_signature& signature, signature_kind kind) const NOEXCEPT;
+    const shard& shard_at(const hash_digest& digest) const NOEXCEPT;
+    shard& shard_at(const hash_digest& digest) NOEXCEPT;
+    size_t bucket(const hash_digest& digest) const NOEXCEPT;
+
+    // These are thread safe.
+    const size_t buckets_;
+    const hash_digest salt_;
+
+    // Each shard is protected by its own mutex.
+    std::array<shard, shards> shards_{};
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -47,6 +47,8 @@ enum script_error_t : uint8_t
     invalid_witness,
     invalid_witness_stack,
     dirty_witness,
+    invalid_taproot_signature,
+    unsupported_taproot_script,
     stack_false,
 
     // chained to op_error_t
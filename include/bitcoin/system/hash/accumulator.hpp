@@ -52,6 +52,9 @@ public:
     /// Reset accumulator to initial state (to reuse after flushing).
     constexpr void reset() NOEXCEPT;
 
+    /// Accumulated state, of whole blocks only (excludes buffered bytes).
+    constexpr const state_t& state() const NOEXCEPT;
+
     /// Write data to accumulator.
     /// -----------------------------------------------------------------------
 
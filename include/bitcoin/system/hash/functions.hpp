@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/endian/endian.hpp>
@@ -132,12 +133,19 @@ INLINE hash_digest bitcoin_hash2(const data_slice& left,
 template <typename Type>
 INLINE data_chunk bitcoin_chunk(const Type& data) NOEXCEPT;
 
+/// Tagged hash (sha256(sha256(tag) || sha256(tag) || data)) [bip340].
+INLINE hash_digest tagged_hash(const std::string& tag,
+    const data_slice& data) NOEXCEPT;
+
 /// Merkle root from a bitcoin_hash set [chain].
 INLINE hash_digest merkle_root(hashes&& set) NOEXCEPT;
 
 /// Litecoin scrypt hash [chain].
 INLINE hash_digest scrypt_hash(const data_slice& data) NOEXCEPT;
 
+/// Litecoin scrypt hashes, romixed across vector lanes (empty if no memory).
+INLINE hashes scrypt_hashes(const std::vector<data_slice>& set) NOEXCEPT;
+
 /// Hash table keying.
 /// ---------------------------------------------------------------------------
 
@@ -35,6 +35,7 @@ class hmac
 public:
     DEFAULT_COPY_MOVE_DESTRUCT(hmac);
     using digest_t = typename Algorithm::digest_t;
+    using state_t = typename Algorithm::state_t;
 
     /// hmac accumulator, not resettable.
     inline hmac(const data_slice& key) NOEXCEPT;
@@ -42,6 +43,10 @@ public:
     inline void write(const data_slice& data) NOEXCEPT;
     inline digest_t flush() NOEXCEPT;
 
+    /// Key pad midstates, of one block each (valid only prior to write).
+    inline const state_t& inner_state() const NOEXCEPT;
+    inline const state_t& outer_state() const NOEXCEPT;
+
     /// finalized authentication code.
     static inline digest_t code(const data_slice& data,
         const data_slice& key) NOEXCEPT;
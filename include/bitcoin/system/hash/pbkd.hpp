@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_HASH_PBKD_HPP
 #define LIBBITCOIN_SYSTEM_HASH_PBKD_HPP
 
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/endian/endian.hpp>
@@ -54,6 +55,14 @@ struct pbkd
     static inline data_array<Size> key(const data_slice& password,
         const data_slice& salt, size_t count) NOEXCEPT;
 
+    /// Keys for each password/salt pair, empty if pair counts differ.
+    /// Iterations of sha256/512 hmac are chained across vector lanes.
+    template <size_t Size,
+        if_not_greater<Size, pbkd_maximum_size<Algorithm>> = true>
+    static inline std::vector<data_array<Size>> keys(
+        const std::vector<data_slice>& passwords,
+        const std::vector<data_slice>& salts, size_t count) NOEXCEPT;
+
 protected:
     template <size_t Length>
     static constexpr auto xor_n(data_array<Length>& to,
@@ -19,12 +19,15 @@
 #ifndef LIBBITCOIN_SYSTEM_HASH_SCRYPT_HPP
 #define LIBBITCOIN_SYSTEM_HASH_SCRYPT_HPP
 
+#include <atomic>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/endian/endian.hpp>
 #include <bitcoin/system/hash/algorithms.hpp>
 #include <bitcoin/system/hash/pbkd.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/math/math.hpp>
 
 namespace libbitcoin {
@@ -43,6 +46,7 @@ constexpr auto is_scrypt_args =
     !is_multiply_overflow(R, 128_size);
 
 /// Concurrent increases memory consumption from minimum to maximum.
+/// Concurrent also romixes independent rblocks across available vector lanes.
 template<size_t W, size_t R, size_t P, bool Concurrent = false,
     bool_if<is_scrypt_args<W, R, P>> If = true>
 class scrypt
@@ -76,6 +80,15 @@ public:
     static data_array<Size> hash(const data_slice& password,
         const data_slice& salt) NOEXCEPT;
 
+    /// Hashes for each password/salt pair, empty if out of memory or if pair
+    /// counts differ. The rblocks of all pairs are romixed together, so with
+    /// Concurrent these are interleaved across vector lanes (e.g. Litecoin).
+    template<size_t Size, if_not_greater<Size,
+        scrypt_derivation::maximum_size> = true>
+    static std::vector<data_array<Size>> hashes(
+        const std::vector<data_slice>& passwords,
+        const std::vector<data_slice>& salts) NOEXCEPT;
+
 protected:
     using word_t    = uint32_t;
     using words_t   = std_array<word_t,   block_size / sizeof(word_t)>;
@@ -83,8 +96,23 @@ protected:
     using rblock_t  = std_array<block_t,  R * 2_size>;
     using prblock_t = std_array<rblock_t, P>;
     using wrblock_t = std_array<rblock_t, W>;
+    using rblocks_t = std::vector<rblock_t*>;
     static_assert(size_of<prblock_t>() <= scrypt_derivation::maximum_size);
 
+    /// Vectorization, word i of each lane's block is word i of the xblock.
+    template <typename xWord>
+    static constexpr auto lanes = capacity<xWord, word_t>;
+    template <typename xWord>
+    using xwords_t = std_array<xWord, array_count<words_t>>;
+    template <typename xWord>
+    using xrblock_t = std_array<xwords_t<xWord>, R * 2_size>;
+    template <typename xWord>
+    using xyblock_t = std_array<xwords_t<xWord>, R>;
+    template <typename xWord>
+    using xwrblock_t = std_array<wrblock_t, lanes<xWord>>;
+    template <typename xWord>
+    using xrblocks_t = std_array<rblock_t*, lanes<xWord>>;
+
     static constexpr words_t& add(words_t& to, const words_t& from) NOEXCEPT;
     static constexpr block_t& xor_(block_t& to, const block_t& from) NOEXCEPT;
     static constexpr rblock_t& xor_(rblock_t& to, const rblock_t& from) NOEXCEPT;
@@ -95,6 +123,35 @@ protected:
     static inline block_t& salsa_8(block_t& block) NOEXCEPT;
     static inline bool block_mix(rblock_t& rblock) NOEXCEPT;
     static inline bool romix(rblock_t& rblock) NOEXCEPT;
+    static inline bool romix(const rblocks_t& rblocks) NOEXCEPT;
+
+    template <typename xWord>
+    static INLINE xwords_t<xWord>& xor_(xwords_t<xWord>& to,
+        const xwords_t<xWord>& from) NOEXCEPT;
+    template <typename xWord>
+    static INLINE void xor_(xrblock_t<xWord>& to,
+        const xrblocks_t<xWord>& from) NOEXCEPT;
+    template <typename xWord>
+    static INLINE void copy(xrblock_t<xWord>& to,
+        const xrblocks_t<xWord>& from) NOEXCEPT;
+    template <typename xWord>
+    static INLINE void copy(const xrblocks_t<xWord>& to,
+        const xrblock_t<xWord>& from) NOEXCEPT;
+    template <typename xWord>
+    static INLINE void index(xrblocks_t<xWord>& to, xwrblock_t<xWord>& from,
+        const xrblock_t<xWord>& xrblock) NOEXCEPT;
+    template <size_t A, size_t B, size_t C, size_t D, typename xWord>
+    static INLINE void salsa_qr(xwords_t<xWord>& words) NOEXCEPT;
+    template <typename xWord>
+    static inline void salsa_8(xwords_t<xWord>& xblock) NOEXCEPT;
+    template <typename xWord>
+    static inline void block_mix(xrblock_t<xWord>& xrblock,
+        xyblock_t<xWord>& xyblock) NOEXCEPT;
+    template <typename xWord>
+    static inline bool romix(const xrblocks_t<xWord>& rblocks) NOEXCEPT;
+    template <typename xWord, if_extended<xWord> = true>
+    static inline void romix_vector(std::atomic_bool& success,
+        const rblocks_t& rblocks, size_t& position) NOEXCEPT;
 
 private:
     static CONSTEVAL auto& concurrency() NOEXCEPT;
@@ -116,6 +116,28 @@ public:
     static VCONSTEXPR digests_t& merkle_hash(digests_t& digests) NOEXCEPT;
     static VCONSTEXPR digest_t merkle_root(digests_t&& digests) NOEXCEPT;
 
+    /// Multiple message double hashing (sha256/512).
+    /// -----------------------------------------------------------------------
+    /// Messages are of arbitrary length, digests are returned in message order.
+    using messages_t = std_vector<data_slice>;
+    static digests_t double_hashes(const messages_t& messages) NOEXCEPT;
+
+    /// Iterated hmac chains (sha256/512).
+    /// -----------------------------------------------------------------------
+    /// Each chain is hmac key pad midstates and a first code U_1, iterated as
+    /// U_c = hmac(U_c-1), returning U_1 ^ ... ^ U_count (pbkdf2 F function).
+    struct hmac_chain_t
+    {
+        state_t inner;
+        state_t outer;
+        digest_t code;
+    };
+
+    using hmac_chains_t = std::vector<hmac_chain_t>;
+    static constexpr auto hmac_chaining = is_same_size<digest_t, half_t>;
+    static digests_t hmac_chains(const hmac_chains_t& chains,
+        size_t count) NOEXCEPT;
+
     /// Streamed hashing (explicitly finalized).
     /// -----------------------------------------------------------------------
     static void accumulate(state_t& state, iblocks_t&& blocks) NOEXCEPT;
@@ -339,6 +361,51 @@ protected:
 
     INLINE static void merkle_hash_vector(digests_t& digests) NOEXCEPT;
 
+    /// Messages.
+    /// -----------------------------------------------------------------------
+protected:
+    using indexes_t = std::vector<size_t>;
+    using iindex_t = typename indexes_t::const_iterator;
+
+    static constexpr size_t message_blocks(size_t size) NOEXCEPT;
+    INLINE static void message_block(block_t& block, const data_slice& message,
+        size_t index) NOEXCEPT;
+    static digest_t double_hash_message(const data_slice& message) NOEXCEPT;
+
+    template <typename xWord>
+    INLINE static void output(digests_t& digests, const iindex_t& indexes,
+        const xstate_t<xWord>& xstate) NOEXCEPT;
+
+    template <typename xWord, if_extended<xWord> = true>
+    INLINE static void double_hash_vector(digests_t& digests,
+        const messages_t& messages, iindex_t& first, const iindex_t& last,
+        size_t blocks) NOEXCEPT;
+
+    /// Iterated hmac.
+    /// -----------------------------------------------------------------------
+protected:
+    template <size_t Lanes>
+    using xstates_t = std_array<state_t, Lanes>;
+
+    static CONSTEVAL chunk_t hmac_pad() NOEXCEPT;
+    INLINE static void pad_hmac(buffer_t& buffer) NOEXCEPT;
+    template <typename xWord>
+    INLINE static void pad_hmac(xbuffer_t<xWord>& xbuffer) NOEXCEPT;
+
+    template <size_t Word, size_t Lanes>
+    INLINE static auto pack_word(const xstates_t<Lanes>& states) NOEXCEPT;
+    template <typename xWord, size_t Lanes>
+    INLINE static auto pack_states(const xstates_t<Lanes>& states) NOEXCEPT;
+    INLINE static constexpr void xor_state(auto& to, const auto& from) NOEXCEPT;
+    INLINE static state_t to_state(const digest_t& digest) NOEXCEPT;
+
+    static digest_t hmac_chain(const hmac_chain_t& chain,
+        size_t count) NOEXCEPT;
+
+    template <typename xWord, if_extended<xWord> = true>
+    INLINE static void hmac_chains_vector(idigests_t& digests,
+        const hmac_chains_t& chains, size_t& position, size_t count) NOEXCEPT;
+
 public:
     static constexpr auto use_neon = Native && system::with_neon;
     static constexpr auto use_shani = Native && system::with_shani;
@@ -373,8 +440,10 @@ BC_PUSH_WARNING(NO_ARRAY_INDEXING)
 #include <bitcoin/system/impl/hash/sha/algorithm_compress.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_double.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_functions.ipp>
+#include <bitcoin/system/impl/hash/sha/algorithm_hmac.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_iterate.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_merkle.ipp>
+#include <bitcoin/system/impl/hash/sha/algorithm_messages.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_native.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_padding.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_parsing.ipp>
@@ -127,7 +127,7 @@
     #define HAVE_ICU
 #endif
 
-/// XCPU architecture intrinsics sse41, avx2, avx512f, sha-ni.
+/// XCPU architecture intrinsics sse41, avx2, avx512f, sha-ni, aes-ni, vaes.
 /// This assumes that avx512 implies avx2 and that all imply sse41.
 /// All require runtime evaluation for the binary is portable across XCPUs.
 #if defined(HAVE_XCPU)
@@ -135,15 +135,23 @@
     #if defined(WITH_SHANI)
         #define HAVE_SHANI
     #endif
+    #if defined(WITH_AESNI)
+        #define HAVE_AESNI
+    #endif
     #if defined(WITH_AVX512)
         #define HAVE_AVX512
     #endif
     #if defined(WITH_AVX2) || defined(WITH_AVX512)
         #define HAVE_AVX2
     #endif
-    #if defined(WITH_SSE41) || defined(WITH_AVX2) || defined(WITH_SHANI)
+    #if defined(WITH_SSE41) || defined(WITH_AVX2) || defined(WITH_SHANI) || \
+        defined(WITH_AESNI)
         #define HAVE_SSE41
     #endif
+    // VAES (aes-ni over avx512) requires both aesni and avx512 builds.
+    #if defined(WITH_VAES) && defined(HAVE_AESNI) && defined(HAVE_AVX512)
+        #define HAVE_VAES
+    #endif
 #endif
 
 /// MSC predefined constant for Visual Studio version (exclusive).
@@ -79,12 +79,11 @@ compact::from_compact(const parse& compact) NOEXCEPT
     );
 }
 
-// public
-
-constexpr compact::span_type
-compact::expand(small_type exponential) NOEXCEPT
+// Negative returns zero, which expands to zero.
+constexpr typename compact::small_type
+compact::normalize(small_type small) NOEXCEPT
 {
-    auto compact = to_compact(exponential);
+    auto compact = to_compact(small);
 
     if (compact.negative)
         return 0;
@@ -99,8 +98,37 @@ compact::expand(small_type exponential) NOEXCEPT
     }
 
     // Above exists only because negatives were inadvertently excluded.
-    
-    return base256e::expand(from_compact(compact));
+
+    return from_compact(compact);
+}
+
+// public
+
+constexpr compact::span_type
+compact::expand(small_type exponential) NOEXCEPT
+{
+    return base256e::expand(normalize(exponential));
+}
+
+// This follows base256e::expand, over uint256 in place of span_type.
+constexpr uint256
+compact::expand_fixed(small_type exponential) NOEXCEPT
+{
+    const auto small = normalize(exponential);
+    const auto shift = raise(shift_right(small, precision));
+    const auto mantissa = mask_left<small_type>(small, e_width);
+
+    // Zero returned if unsigned exponent is out of bounds [0..e_max].
+    if (is_limited(shift, span))
+        return {};
+
+    uint256 number{ mantissa };
+
+    shift > precision ?
+        number <<= (shift - precision) :
+        number >>= (precision - shift);
+
+    return number;
 }
 
 constexpr compact::small_type
@@ -336,6 +336,45 @@ constexpr bool operation::is_reserved(opcode code) NOEXCEPT
     }
 }
 
+// Deserialization utilities.
+// ----------------------------------------------------------------------------
+// Templated on the reader so that a final (fast) reader is not dispatched.
+
+// static/private
+// Advances stream, returns true unless exhausted.
+// Does not advance to end position in the case of underflow operation.
+template <typename Source>
+inline bool operation::count_op(Source& source) NOEXCEPT
+{
+    if (source.is_exhausted())
+        return false;
+
+    const auto code = static_cast<opcode>(source.read_byte());
+    source.skip_bytes(read_data_size(code, source));
+    return true;
+}
+
+// static/private
+template <typename Source>
+inline uint32_t operation::read_data_size(opcode code,
+    Source& source) NOEXCEPT
+{
+    constexpr auto op_75 = static_cast<uint8_t>(opcode::push_size_75);
+
+    switch (code)
+    {
+        case opcode::push_one_size:
+            return source.read_byte();
+        case opcode::push_two_size:
+            return source.read_2_bytes_little_endian();
+        case opcode::push_four_size:
+            return source.read_4_bytes_little_endian();
+        default:
+            const auto byte = static_cast<uint8_t>(code);
+            return byte <= op_75 ? byte : 0;
+    }
+}
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
@@ -240,6 +240,13 @@ reset() NOEXCEPT
     state_ = Algorithm::H::get;
 }
 
+TEMPLATE
+constexpr const typename CLASS::state_t& CLASS::
+state() const NOEXCEPT
+{
+    return state_;
+}
+
 TEMPLATE
 constexpr CLASS::
 accumulator() NOEXCEPT
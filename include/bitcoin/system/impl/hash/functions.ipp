@@ -183,6 +183,18 @@ INLINE data_chunk bitcoin_chunk(const Type& data) NOEXCEPT
     return accumulator<sha256>::double_hash_chunk(data);
 }
 
+INLINE hash_digest tagged_hash(const std::string& tag,
+    const data_slice& data) NOEXCEPT
+{
+    // The tag prefix is one block, so its state may be cached by the caller.
+    const auto prefix = accumulator<sha256>::hash(tag);
+    accumulator<sha256> context{};
+    context.write(prefix);
+    context.write(prefix);
+    context.write(data.size(), data.data());
+    return context.flush();
+}
+
 /// Merkle root from a bitcoin_hash set [chain].
 INLINE hash_digest merkle_root(hashes&& set) NOEXCEPT
 {
@@ -196,6 +208,13 @@ INLINE hash_digest scrypt_hash(const data_slice& data) NOEXCEPT
     return scrypt<1024, 1, 1, true>::hash<hash_size>(data, data);
 }
 
+// Litecoin scrypt hashes [chain].
+INLINE hashes scrypt_hashes(const std::vector<data_slice>& set) NOEXCEPT
+{
+    // Litecoin parameters, concurrency enabled (data is password and salt).
+    return scrypt<1024, 1, 1, true>::hashes<hash_size>(set, set);
+}
+
 // Hash table keying.
 // ----------------------------------------------------------------------------
 
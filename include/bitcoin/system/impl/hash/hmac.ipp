@@ -74,6 +74,22 @@ flush() NOEXCEPT
     return outer_.flush();
 }
 
+TEMPLATE
+inline const typename CLASS::state_t&
+CLASS::
+inner_state() const NOEXCEPT
+{
+    return inner_.state();
+}
+
+TEMPLATE
+inline const typename CLASS::state_t&
+CLASS::
+outer_state() const NOEXCEPT
+{
+    return outer_.state();
+}
+
 BC_PUSH_WARNING(NO_ARRAY_INDEXING)
 BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
 BC_PUSH_WARNING(NO_UNGUARDED_POINTERS)
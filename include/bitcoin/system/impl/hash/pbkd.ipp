@@ -20,6 +20,8 @@
 #define LIBBITCOIN_SYSTEM_HASH_PBKD_IPP
 
 #include <algorithm>
+#include <iterator>
+#include <vector>
 
 // based on:
 // datatracker.ietf.org/doc/html/rfc8018
@@ -140,6 +142,71 @@ key(const data_slice& password, const data_slice& salt,
     return dk;
 }
 
+TEMPLATE
+template <size_t Size, if_not_greater<Size, pbkd_maximum_size<Algorithm>>>
+inline std::vector<data_array<Size>> CLASS::
+keys(const std::vector<data_slice>& passwords,
+    const std::vector<data_slice>& salts, size_t count) NOEXCEPT
+{
+    if (passwords.size() != salts.size())
+        return {};
+
+    std::vector<data_array<Size>> out(passwords.size());
+
+    // Pseudorandom functions other than sha256/512 hmac are not chained.
+    if constexpr (!requires { requires Algorithm::hmac_chaining; })
+    {
+        for (size_t pair = 0; pair < out.size(); ++pair)
+            key(out[pair], passwords[pair], salts[pair], count);
+
+        return out;
+    }
+    else
+    {
+        constexpr auto hlen = array_count<typename Algorithm::digest_t>;
+        constexpr auto l = ceilinged_divide(Size, hlen);
+        constexpr auto r = Size - sub1(l) * hlen;
+        constexpr auto words = to_big_endians(sequence<uint32_t, add1(l)>);
+        const auto& index = array_cast<std_array<uint8_t, sizeof(uint32_t)>>(
+            words);
+
+        // Salted hmac accumulators and key pad midstates of each pair.
+        std::vector<hmac<Algorithm>> salted{};
+        typename Algorithm::hmac_chains_t chains(out.size());
+        salted.reserve(out.size());
+
+        for (size_t pair = 0; pair < out.size(); ++pair)
+        {
+            const hmac<Algorithm> hmac_p(passwords[pair]);
+            chains[pair].inner = hmac_p.inner_state();
+            chains[pair].outer = hmac_p.outer_state();
+            salted.push_back(hmac_p);
+            salted.back().write(salts[pair]);
+        }
+
+        // Each block T_i of all pairs is F (P, S, c, i), iterated as chains.
+        for (size_t i = 1; i <= l; ++i)
+        {
+            for (size_t pair = 0; pair < out.size(); ++pair)
+            {
+                // U_1 = PRF (P, S || INT (i))
+                auto ps = salted[pair];
+                ps.write(index.at(i));
+                chains[pair].code = ps.flush();
+            }
+
+            const auto ts = Algorithm::hmac_chains(chains, count);
+            const auto offset = sub1(i) * hlen;
+
+            for (size_t pair = 0; pair < out.size(); ++pair)
+                std::copy_n(ts[pair].begin(), (i == l ? r : hlen),
+                    std::next(out[pair].begin(), offset));
+        }
+
+        return out;
+    }
+}
+
 } // namespace system
 } // namespace libbitcoin
 
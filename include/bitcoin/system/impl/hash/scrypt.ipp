@@ -22,7 +22,9 @@
 #include <atomic>
 #include <algorithm>
 #include <bit>
+#include <iterator>
 #include <memory>
+#include <vector>
 
 // Based on:
 // tools.ietf.org/html/rfc7914
@@ -467,6 +469,268 @@ romix(rblock_t& rblock) NOEXCEPT
     return true;
 }
 
+TEMPLATE
+inline bool CLASS::
+romix(const rblocks_t& rblocks) NOEXCEPT
+{
+    std::atomic_bool success{ true };
+    auto position = zero;
+
+    // Romixing lanes of rblocks together raises peak memory to that of
+    // concurrent execution, so vectorization is limited to Concurrent.
+    if constexpr (Concurrent)
+    {
+        // Lane vector dispatch (advances position).
+        romix_vector<xint512_t>(success, rblocks, position);
+        romix_vector<xint256_t>(success, rblocks, position);
+        romix_vector<xint128_t>(success, rblocks, position);
+    }
+
+    // Complete rblocks using normal form.
+    std_for_each(concurrency(), std::next(rblocks.begin(), position),
+        rblocks.end(), [&](rblock_t* rblock) NOEXCEPT
+        {
+            success = success && romix(*rblock);
+        });
+
+    return success;
+}
+
+// vectorized
+// ----------------------------------------------------------------------------
+// protected
+// Independent rblocks are processed in lanes, with word i of each lane's
+// block in word i of an xblock. Lane rblocks are transposed in once per romix
+// and remain transposed across all block mixes. Only the W rblock working set
+// is held per lane (untransposed), as the romix index differs by lane.
+
+TEMPLATE
+template <typename xWord>
+INLINE typename CLASS::template xwords_t<xWord>& CLASS::
+xor_(xwords_t<xWord>& to, const xwords_t<xWord>& from) NOEXCEPT
+{
+    for (size_t word = 0; word < array_count<words_t>; ++word)
+        to[word] = f::xor_(to[word], from[word]);
+
+    return to;
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+xor_(xrblock_t<xWord>& to, const xrblocks_t<xWord>& from) NOEXCEPT
+{
+    std_array<word_t, lanes<xWord>> column{};
+
+    for (size_t block = 0; block < (R << 1); ++block)
+    {
+        for (size_t word = 0; word < array_count<words_t>; ++word)
+        {
+            for (size_t lane = 0; lane < lanes<xWord>; ++lane)
+                column[lane] = native_from_little_end(
+                    array_cast<word_t>((*from[lane])[block])[word]);
+
+            to[block][word] = f::xor_(to[block][word],
+                load(array_cast<uint8_t>(column)));
+        }
+    }
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+copy(xrblock_t<xWord>& to, const xrblocks_t<xWord>& from) NOEXCEPT
+{
+    std_array<word_t, lanes<xWord>> column{};
+
+    for (size_t block = 0; block < (R << 1); ++block)
+    {
+        for (size_t word = 0; word < array_count<words_t>; ++word)
+        {
+            for (size_t lane = 0; lane < lanes<xWord>; ++lane)
+                column[lane] = native_from_little_end(
+                    array_cast<word_t>((*from[lane])[block])[word]);
+
+            to[block][word] = load(array_cast<uint8_t>(column));
+        }
+    }
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+copy(const xrblocks_t<xWord>& to, const xrblock_t<xWord>& from) NOEXCEPT
+{
+    std_array<word_t, lanes<xWord>> column{};
+
+    for (size_t block = 0; block < (R << 1); ++block)
+    {
+        for (size_t word = 0; word < array_count<words_t>; ++word)
+        {
+            store(array_cast<uint8_t>(column), from[block][word]);
+
+            for (size_t lane = 0; lane < lanes<xWord>; ++lane)
+                array_cast<word_t>((*to[lane])[block])[word] =
+                    native_to_little_end(column[lane]);
+        }
+    }
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+index(xrblocks_t<xWord>& to, xwrblock_t<xWord>& from,
+    const xrblock_t<xWord>& xrblock) NOEXCEPT
+{
+    // j = Integerify (X) mod N, where the first two (native) words of the
+    // last block of each lane are the low and high words of the integer.
+    std_array<word_t, lanes<xWord>> low{};
+    std_array<word_t, lanes<xWord>> high{};
+    store(array_cast<uint8_t>(low), xrblock.back()[0]);
+    store(array_cast<uint8_t>(high), xrblock.back()[1]);
+
+    for (size_t lane = 0; lane < lanes<xWord>; ++lane)
+    {
+        const auto integer = bit_or<uint64_t>(
+            shift_left<uint64_t>(high[lane], bits<word_t>), low[lane]);
+
+        to[lane] = &from[lane][possible_narrow_cast<size_t>(integer % W)];
+    }
+}
+
+TEMPLATE
+template <size_t A, size_t B, size_t C, size_t D, typename xWord>
+INLINE void CLASS::
+salsa_qr(xwords_t<xWord>& words) NOEXCEPT
+{
+    // Salsa20/8 Quarter Round
+    words[B] = f::xor_(words[B], f::rol<7, 32>(f::add<32>(words[A], words[D])));
+    words[C] = f::xor_(words[C], f::rol<9, 32>(f::add<32>(words[B], words[A])));
+    words[D] = f::xor_(words[D], f::rol<13, 32>(f::add<32>(words[C], words[B])));
+    words[A] = f::xor_(words[A], f::rol<18, 32>(f::add<32>(words[D], words[C])));
+}
+
+TEMPLATE
+template <typename xWord>
+inline void CLASS::
+salsa_8(xwords_t<xWord>& xblock) NOEXCEPT
+{
+    const auto save = xblock;
+
+    // salsa20/8 is salsa20 with 8 vs. 20 rounds.
+    for (size_t i = 0; i < 4u; ++i)
+    {
+        // columns
+        salsa_qr< 0,  4,  8, 12>(xblock);
+        salsa_qr< 5,  9, 13,  1>(xblock);
+        salsa_qr<10, 14,  2,  6>(xblock);
+        salsa_qr<15,  3,  7, 11>(xblock);
+
+        // rows
+        salsa_qr< 0,  1,  2,  3>(xblock);
+        salsa_qr< 5,  6,  7,  4>(xblock);
+        salsa_qr<10, 11,  8,  9>(xblock);
+        salsa_qr<15, 12, 13, 14>(xblock);
+    }
+
+    for (size_t word = 0; word < array_count<words_t>; ++word)
+        xblock[word] = f::add<32>(xblock[word], save[word]);
+}
+
+TEMPLATE
+template <typename xWord>
+inline void CLASS::
+block_mix(xrblock_t<xWord>& xrblock, xyblock_t<xWord>& xyblock) NOEXCEPT
+{
+    // X = B[2 * r - 1]
+    auto xblock = xrblock.back();
+
+    // Even blocks are copied over consumed blocks, odds are deferred.
+    for (size_t i = 0; i < R; ++i)
+    {
+        salsa_8(xor_(xblock, xrblock[i << 1]));
+        xrblock[i] = xblock;
+
+        salsa_8(xor_(xblock, xrblock[add1(i << 1)]));
+        xyblock[i] = xblock;
+    }
+
+    for (size_t i = 0; i < R; ++i)
+        xrblock[i + R] = xyblock[i];
+}
+
+TEMPLATE
+template <typename xWord>
+inline bool CLASS::
+romix(const xrblocks_t<xWord>& rblocks) NOEXCEPT
+{
+    // Make a working set of W rblocks for each lane.
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // [lanes * (W * (R * 128))] bytes heap allocated.
+    const auto wptr = to_shared<xwrblock_t<xWord>>();
+    if (!wptr) return false;
+    auto& wrblocks = *wptr;
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    // Make 3R working xblocks (transposed rblock and half rblock).
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // [lanes * (R * 192)] bytes heap allocated.
+    const auto xptr = to_shared<xrblock_t<xWord>>();
+    const auto yptr = to_shared<xyblock_t<xWord>>();
+    if (!xptr || !yptr) return false;
+    auto& xrblock = *xptr;
+    auto& xyblock = *yptr;
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    xrblocks_t<xWord> vrblocks{};
+    copy(xrblock, rblocks);
+
+    for (size_t i = 0; i < W; ++i)
+    {
+        for (size_t lane = 0; lane < lanes<xWord>; ++lane)
+            vrblocks[lane] = &wrblocks[lane][i];
+
+        copy(vrblocks, xrblock);
+        block_mix<xWord>(xrblock, xyblock);
+    }
+
+    // Each lane selects its own index, so lanes never diverge in count.
+    for (size_t i = 0; i < W; ++i)
+    {
+        index<xWord>(vrblocks, wrblocks, xrblock);
+        xor_(xrblock, vrblocks);
+        block_mix<xWord>(xrblock, xyblock);
+    }
+
+    copy(rblocks, xrblock);
+    return true;
+}
+
+TEMPLATE
+template <typename xWord, if_extended<xWord>>
+inline void CLASS::
+romix_vector(std::atomic_bool& success, const rblocks_t& rblocks,
+    size_t& position) NOEXCEPT
+{
+    if constexpr (have<xWord>())
+    {
+        const auto count = (rblocks.size() - position) / lanes<xWord>;
+        if (is_zero(count))
+            return;
+
+        std::vector<xrblocks_t<xWord>> groups(count);
+        for (auto& group: groups)
+            for (auto& rblock: group)
+                rblock = rblocks[position++];
+
+        std_for_each(concurrency(), groups.begin(), groups.end(),
+            [&](const xrblocks_t<xWord>& group) NOEXCEPT
+            {
+                success = success && romix<xWord>(group);
+            });
+    }
+}
+
 // public
 // ----------------------------------------------------------------------------
 
@@ -498,12 +762,12 @@ CLASS::hash(data_array<Size>& out, const data_slice& password,
     // 2. for i = 0 to p - 1 do
     //    B[i] = scryptROMix (r, B[i], N)
     // end for
-    std::atomic_bool success{ true };
-    std_for_each(concurrency(), prblocks.begin(), prblocks.end(),
-        [&](rblock_t& rblock) NOEXCEPT
-        {
-            success = success && romix(rblock);
-        });
+    rblocks_t rblocks(P);
+    for (size_t i = 0; i < P; ++i)
+        rblocks[i] = &prblocks[i];
+
+    if (!romix(rblocks))
+        return false;
 
     // rfc7914
     // 3. DK = PBKDF2-HMAC-SHA256 (P, B[0] || B[1] || ... || B[p - 1], 1, dkLen)
@@ -521,6 +785,48 @@ CLASS::hash(const data_slice& password, const data_slice& salt) NOEXCEPT
     return out;
 }
 
+TEMPLATE
+template<size_t Size, if_not_greater<Size, scrypt_derivation::maximum_size>>
+std::vector<data_array<Size>>
+CLASS::hashes(const std::vector<data_slice>& passwords,
+    const std::vector<data_slice>& salts) NOEXCEPT
+{
+    if (passwords.size() != salts.size())
+        return {};
+
+    const auto count = passwords.size();
+
+    // Make a working set of P rblocks for each pair.
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // [count * P * (R * 128)] bytes heap allocated.
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::vector<prblock_t> prblocks(count);
+    rblocks_t rblocks{};
+    rblocks.reserve(count * P);
+    BC_POP_WARNING()
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    for (size_t pair = 0; pair < count; ++pair)
+    {
+        scrypt_derivation::key(array_cast<uint8_t>(prblocks[pair]),
+            passwords[pair], salts[pair], one);
+
+        for (auto& rblock: prblocks[pair])
+            rblocks.push_back(&rblock);
+    }
+
+    // All rblocks are independent, so are romixed as one set.
+    if (!romix(rblocks))
+        return {};
+
+    std::vector<data_array<Size>> out(count);
+    for (size_t pair = 0; pair < count; ++pair)
+        scrypt_derivation::key(out[pair], passwords[pair],
+            array_cast<uint8_t>(prblocks[pair]), one);
+
+    return out;
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 BC_POP_WARNING()
@@ -0,0 +1,324 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_SHA_ALGORITHM_HMAC_IPP
+#define LIBBITCOIN_SYSTEM_HASH_SHA_ALGORITHM_HMAC_IPP
+
+// Iterated hmac.
+// ============================================================================
+// An hmac of a code (half block) following key pad midstates is two single
+// block compressions, each of the code (state) and a constant pad. The state
+// is reinput directly, so there is no serialization between iterations.
+// Independent chains are iterated across vector lanes.
+
+namespace libbitcoin {
+namespace system {
+namespace sha {
+
+// padding
+// ----------------------------------------------------------------------------
+// protected
+
+TEMPLATE
+CONSTEVAL typename CLASS::chunk_t CLASS::
+hmac_pad() NOEXCEPT
+{
+    // One key pad block and the half block code (hmac message).
+    constexpr auto bytes = possible_narrow_cast<word_t>(
+        array_count<block_t> + array_count<half_t>);
+
+    chunk_t out{};
+    out.front() = bit_hi<word_t>;
+    out.back() = to_bits(bytes);
+    return out;
+}
+
+TEMPLATE
+INLINE void CLASS::
+pad_hmac(buffer_t& buffer) NOEXCEPT
+{
+    constexpr auto pad = hmac_pad();
+    array_cast<word_t, SHA::chunk_words, SHA::chunk_words>(buffer) = pad;
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+pad_hmac(xbuffer_t<xWord>& xbuffer) NOEXCEPT
+{
+    constexpr auto pad = hmac_pad();
+    static const xchunk_t<xWord> xpad
+    {
+        broadcast<xWord>(pad[0]),
+        broadcast<xWord>(pad[1]),
+        broadcast<xWord>(pad[2]),
+        broadcast<xWord>(pad[3]),
+        broadcast<xWord>(pad[4]),
+        broadcast<xWord>(pad[5]),
+        broadcast<xWord>(pad[6]),
+        broadcast<xWord>(pad[7])
+    };
+
+    array_cast<xWord, SHA::chunk_words, SHA::chunk_words>(xbuffer) = xpad;
+}
+
+// state
+// ----------------------------------------------------------------------------
+// protected
+
+TEMPLATE
+template <size_t Word, size_t Lanes>
+INLINE auto CLASS::
+pack_word(const xstates_t<Lanes>& states) NOEXCEPT
+{
+    using xword = to_extended<word_t, Lanes>;
+
+    if constexpr (Lanes == 2)
+    {
+        return set<xword>(
+            states[0][Word],
+            states[1][Word]);
+    }
+    else if constexpr (Lanes == 4)
+    {
+        return set<xword>(
+            states[0][Word],
+            states[1][Word],
+            states[2][Word],
+            states[3][Word]);
+    }
+    else if constexpr (Lanes == 8)
+    {
+        return set<xword>(
+            states[0][Word],
+            states[1][Word],
+            states[2][Word],
+            states[3][Word],
+            states[4][Word],
+            states[5][Word],
+            states[6][Word],
+            states[7][Word]);
+    }
+    else if constexpr (Lanes == 16)
+    {
+        return set<xword>(
+            states[ 0][Word],
+            states[ 1][Word],
+            states[ 2][Word],
+            states[ 3][Word],
+            states[ 4][Word],
+            states[ 5][Word],
+            states[ 6][Word],
+            states[ 7][Word],
+            states[ 8][Word],
+            states[ 9][Word],
+            states[10][Word],
+            states[11][Word],
+            states[12][Word],
+            states[13][Word],
+            states[14][Word],
+            states[15][Word]);
+    }
+}
+
+TEMPLATE
+template <typename xWord, size_t Lanes>
+INLINE auto CLASS::
+pack_states(const xstates_t<Lanes>& states) NOEXCEPT
+{
+    static_assert(Lanes == capacity<xWord, word_t>);
+
+    return xstate_t<xWord>
+    {
+        pack_word<0>(states),
+        pack_word<1>(states),
+        pack_word<2>(states),
+        pack_word<3>(states),
+        pack_word<4>(states),
+        pack_word<5>(states),
+        pack_word<6>(states),
+        pack_word<7>(states)
+    };
+}
+
+TEMPLATE
+INLINE constexpr void CLASS::
+xor_state(auto& to, const auto& from) NOEXCEPT
+{
+    to[0] = f::xor_(to[0], from[0]);
+    to[1] = f::xor_(to[1], from[1]);
+    to[2] = f::xor_(to[2], from[2]);
+    to[3] = f::xor_(to[3], from[3]);
+    to[4] = f::xor_(to[4], from[4]);
+    to[5] = f::xor_(to[5], from[5]);
+    to[6] = f::xor_(to[6], from[6]);
+    to[7] = f::xor_(to[7], from[7]);
+}
+
+TEMPLATE
+INLINE typename CLASS::state_t CLASS::
+to_state(const digest_t& digest) NOEXCEPT
+{
+    buffer_t buffer{};
+    input_left(buffer, digest);
+    return array_cast<word_t, SHA::state_words>(buffer);
+}
+
+// normal form
+// ----------------------------------------------------------------------------
+// protected
+
+TEMPLATE
+typename CLASS::digest_t CLASS::
+hmac_chain(const hmac_chain_t& chain, size_t count) NOEXCEPT
+{
+    auto state = to_state(chain.code);
+    auto sum = state;
+    buffer_t buffer{};
+
+    for (size_t iteration = 1; iteration < count; ++iteration)
+    {
+        // Inner hash of the preceding code.
+        reinput(buffer, state);
+        pad_hmac(buffer);
+        schedule(buffer);
+        state = chain.inner;
+        compress(state, buffer);
+
+        // Outer hash of the inner hash.
+        reinput(buffer, state);
+        pad_hmac(buffer);
+        schedule(buffer);
+        state = chain.outer;
+        compress(state, buffer);
+
+        xor_state(sum, state);
+    }
+
+    return output(sum);
+}
+
+// vectorized
+// ----------------------------------------------------------------------------
+// protected
+
+TEMPLATE
+template <typename xWord, if_extended<xWord>>
+INLINE void CLASS::
+hmac_chains_vector(idigests_t& digests, const hmac_chains_t& chains,
+    size_t& position, size_t count) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+    static_assert(is_valid_lanes<lanes>);
+
+    if constexpr (have<xWord>())
+    {
+        if (chains.size() - position >= lanes)
+        {
+            xstates_t<lanes> inners{};
+            xstates_t<lanes> outers{};
+            xstates_t<lanes> codes{};
+            xbuffer_t<xWord> xbuffer{};
+
+            do
+            {
+                for (size_t lane = 0; lane < lanes; ++lane)
+                {
+                    const auto& chain = chains[position + lane];
+                    inners[lane] = chain.inner;
+                    outers[lane] = chain.outer;
+                    codes[lane] = to_state(chain.code);
+                }
+
+                const auto xinner = pack_states<xWord>(inners);
+                const auto xouter = pack_states<xWord>(outers);
+                auto xstate = pack_states<xWord>(codes);
+                auto xsum = xstate;
+
+                // Each lane iterates the same count, so lanes never diverge.
+                for (size_t iteration = 1; iteration < count; ++iteration)
+                {
+                    reinput(xbuffer, xstate);
+                    pad_hmac(xbuffer);
+                    schedule(xbuffer);
+                    xstate = xinner;
+                    compress(xstate, xbuffer);
+
+                    reinput(xbuffer, xstate);
+                    pad_hmac(xbuffer);
+                    schedule(xbuffer);
+                    xstate = xouter;
+                    compress(xstate, xbuffer);
+
+                    xor_state(xsum, xstate);
+                }
+
+                // output() advances digest iterator by lanes.
+                output(digests, xsum);
+                position += lanes;
+            }
+            while (chains.size() - position >= lanes);
+        }
+    }
+}
+
+// interface
+// ----------------------------------------------------------------------------
+// public
+
+TEMPLATE
+typename CLASS::digests_t CLASS::
+hmac_chains(const hmac_chains_t& chains, size_t count) NOEXCEPT
+{
+    static_assert(hmac_chaining && is_same_type<state_t, chunk_t>);
+
+    digests_t digests(chains.size());
+    auto position = zero;
+
+    if constexpr (vector)
+    {
+        if (chains.size() >= min_lanes)
+        {
+            const auto size = digests.size() * array_count<digest_t>;
+            auto idigests = idigests_t{ size, digests.front().data() };
+
+            // Chain iteration vector dispatch (advances position).
+            if constexpr (use_x512)
+                hmac_chains_vector<xint512_t>(idigests, chains, position,
+                    count);
+            if constexpr (use_x256)
+                hmac_chains_vector<xint256_t>(idigests, chains, position,
+                    count);
+            if constexpr (use_x128)
+                hmac_chains_vector<xint128_t>(idigests, chains, position,
+                    count);
+        }
+    }
+
+    // Complete chains using normal form.
+    for (; position < chains.size(); ++position)
+        digests[position] = hmac_chain(chains[position], count);
+
+    return digests;
+}
+
+} // namespace sha
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,280 @@
+/**
+ * Copyright (c) 2011-2024 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_SHA_ALGORITHM_MESSAGES_IPP
+#define LIBBITCOIN_SYSTEM_HASH_SHA_ALGORITHM_MESSAGES_IPP
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+
+// Multiple message hashing.
+// ============================================================================
+// Independent messages are hashed across vector lanes. Messages are bucketed
+// by padded block count, so that each lane set compresses the same number of
+// blocks. Remaining messages of each bucket are hashed in normal form.
+
+namespace libbitcoin {
+namespace system {
+namespace sha {
+
+// message padding
+// ----------------------------------------------------------------------------
+// protected
+
+TEMPLATE
+constexpr size_t CLASS::
+message_blocks(size_t size) NOEXCEPT
+{
+    // Message bytes, the pad delimiter byte, and the bit count.
+    return ceilinged_divide(size + add1(count_bytes), array_count<block_t>);
+}
+
+TEMPLATE
+INLINE void CLASS::
+message_block(block_t& block, const data_slice& message, size_t index) NOEXCEPT
+{
+    constexpr auto size = array_count<block_t>;
+    const auto start = index * size;
+    const auto length = message.size();
+    const auto data = message.data();
+
+    // Whole message block.
+    if (start + size <= length)
+    {
+        std::copy_n(std::next(data, start), size, block.begin());
+        return;
+    }
+
+    // Remainder (if any) and pad delimiter (if not in preceding block).
+    block.fill(0);
+    if (start <= length)
+    {
+        const auto remainder = length - start;
+        std::copy_n(std::next(data, start), remainder, block.begin());
+        block[remainder] = bit_hi<byte_t>;
+    }
+
+    // Bit count in last block (message is limited to 64 bits of bits).
+    if (index == sub1(message_blocks(length)))
+    {
+        const auto bits = to_big_endian<uint64_t>(to_bits<uint64_t>(length));
+        std::copy(bits.begin(), bits.end(), std::prev(block.end(), bits.size()));
+    }
+}
+
+TEMPLATE
+typename CLASS::digest_t CLASS::
+double_hash_message(const data_slice& message) NOEXCEPT
+{
+    static_assert(is_same_type<state_t, chunk_t>);
+
+    // Whole blocks are iterated in place, padded blocks are copied.
+    const auto blocks = message_blocks(message.size());
+    const auto whole = message.size() / array_count<block_t>;
+    auto iblocks = iblocks_t{ whole * array_count<block_t>, message.data() };
+
+    auto state = H::get;
+    iterate(state, iblocks);
+
+    block_t block{};
+    buffer_t buffer{};
+    for (auto index = whole; index < blocks; ++index)
+    {
+        message_block(block, message, index);
+        input(buffer, block);
+        schedule(buffer);
+        compress(state, buffer);
+    }
+
+    // Second hash
+    reinput(buffer, state);
+    pad_half(buffer);
+    schedule(buffer);
+    state = H::get;
+    compress(state, buffer);
+    return output(state);
+}
+
+// vectorized message hashing
+// ----------------------------------------------------------------------------
+// protected
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+output(digests_t& digests, const iindex_t& indexes,
+    const xstate_t<xWord>& xstate) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+
+    digests[indexes[0]] = unpack<0>(xstate);
+    digests[indexes[1]] = unpack<1>(xstate);
+
+    if constexpr (lanes >= 4)
+    {
+        digests[indexes[2]] = unpack<2>(xstate);
+        digests[indexes[3]] = unpack<3>(xstate);
+    }
+
+    if constexpr (lanes >= 8)
+    {
+        digests[indexes[4]] = unpack<4>(xstate);
+        digests[indexes[5]] = unpack<5>(xstate);
+        digests[indexes[6]] = unpack<6>(xstate);
+        digests[indexes[7]] = unpack<7>(xstate);
+    }
+
+    if constexpr (lanes >= 16)
+    {
+        digests[indexes[8]] = unpack<8>(xstate);
+        digests[indexes[9]] = unpack<9>(xstate);
+        digests[indexes[10]] = unpack<10>(xstate);
+        digests[indexes[11]] = unpack<11>(xstate);
+        digests[indexes[12]] = unpack<12>(xstate);
+        digests[indexes[13]] = unpack<13>(xstate);
+        digests[indexes[14]] = unpack<14>(xstate);
+        digests[indexes[15]] = unpack<15>(xstate);
+    }
+}
+
+TEMPLATE
+template <typename xWord, if_extended<xWord>>
+INLINE void CLASS::
+double_hash_vector(digests_t& digests, const messages_t& messages,
+    iindex_t& first, const iindex_t& last, size_t blocks) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+    static_assert(is_valid_lanes<lanes>);
+
+    if constexpr (have<xWord>())
+    {
+        const auto remaining = [&]() NOEXCEPT
+        {
+            return possible_narrow_and_sign_cast<size_t>(
+                std::distance(first, last));
+        };
+
+        if (remaining() >= lanes)
+        {
+            static const auto initial = pack<xWord>(H::get);
+
+            ablocks_t<lanes> xblocks{};
+            xbuffer_t<xWord> xbuffer{};
+
+            do
+            {
+                auto xstate = initial;
+
+                // Each lane compresses the same block index of its message.
+                for (size_t block = 0; block < blocks; ++block)
+                {
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                        message_block(xblocks[lane], messages[first[lane]],
+                            block);
+
+                    // xinput() advances block iterator by lanes.
+                    auto iblocks = iblocks_t{ array_cast<byte_t>(xblocks) };
+                    xinput(xbuffer, iblocks);
+                    schedule(xbuffer);
+                    compress(xstate, xbuffer);
+                }
+
+                // Second hash
+                reinput(xbuffer, xstate);
+                pad_half(xbuffer);
+                schedule(xbuffer);
+                xstate = initial;
+                compress(xstate, xbuffer);
+
+                output(digests, first, xstate);
+                std::advance(first, lanes);
+            }
+            while (remaining() >= lanes);
+        }
+    }
+}
+
+// interface
+// ----------------------------------------------------------------------------
+// public
+
+TEMPLATE
+typename CLASS::digests_t CLASS::
+double_hashes(const messages_t& messages) NOEXCEPT
+{
+    static_assert(is_same_type<state_t, chunk_t>);
+
+    digests_t digests(messages.size());
+
+    if constexpr (vector)
+    {
+        const auto blocks = [&](size_t index) NOEXCEPT
+        {
+            return message_blocks(messages[index].size());
+        };
+
+        // Bucket message indexes by block count.
+        indexes_t indexes(messages.size());
+        std::iota(indexes.begin(), indexes.end(), zero);
+        std::stable_sort(indexes.begin(), indexes.end(),
+            [&](size_t left, size_t right) NOEXCEPT
+            {
+                return blocks(left) < blocks(right);
+            });
+
+        auto first = indexes.cbegin();
+        while (first != indexes.cend())
+        {
+            const auto count = blocks(*first);
+            const auto last = std::find_if(first, indexes.cend(),
+                [&](size_t index) NOEXCEPT
+                {
+                    return blocks(index) != count;
+                });
+
+            // Message hash vector dispatch (advances first).
+            if constexpr (use_x512)
+                double_hash_vector<xint512_t>(digests, messages, first, last,
+                    count);
+            if constexpr (use_x256)
+                double_hash_vector<xint256_t>(digests, messages, first, last,
+                    count);
+            if constexpr (use_x128)
+                double_hash_vector<xint128_t>(digests, messages, first, last,
+                    count);
+
+            // Complete bucket using normal form.
+            for (; first != last; ++first)
+                digests[*first] = double_hash_message(messages[*first]);
+        }
+    }
+    else
+    {
+        for (size_t index = 0; index < messages.size(); ++index)
+            digests[index] = double_hash_message(messages[index]);
+    }
+
+    return digests;
+}
+
+} // namespace sha
+} // namespace system
+} // namespace libbitcoin
+
+#endif
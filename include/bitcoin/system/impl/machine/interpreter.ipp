@@ -23,9 +23,11 @@
 #include <utility>
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/chain/operation.hpp>
+#include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/machine/number.hpp>
 #include <bitcoin/system/math/math.hpp>
 
@@ -1003,11 +1005,12 @@ op_codeseparator(const op_iterator& op) NOEXCEPT
         error::op_code_separator;
 }
 
+// A terminal checksig result is required true, so it may be deferred.
 template <typename Stack>
 inline op_error_t interpreter<Stack>::
-op_check_sig() NOEXCEPT
+op_check_sig(const op_iterator& op) NOEXCEPT
 {
-    const auto verify = op_check_sig_verify();
+    const auto verify = op_check_sig_verify(std::next(op) == state::end());
     const auto bip66 = state::is_enabled(flags::bip66_rule);
 
     // BIP66: invalid signature encoding fails the operation.
@@ -1023,7 +1026,7 @@ op_check_sig() NOEXCEPT
 // then verified against the key and hash as if obtained from the script.
 template <typename Stack>
 inline op_error_t interpreter<Stack>::
-op_check_sig_verify() NOEXCEPT
+op_check_sig_verify(bool defer) NOEXCEPT
 {
     if (state::stack_size() < 2)
         return error::op_check_sig_verify1;
@@ -1048,6 +1051,10 @@ op_check_sig_verify() NOEXCEPT
     if (!state::prepare(sig, *key, hash, endorsement))
         return error::op_check_sig_verify_parse;
 
+    // Failure is necessarily fatal to the script, so presume success.
+    if (defer && state::defer(*key, hash, sig))
+        return error::op_success;
+
     // TODO: for signing mode - make key mutable and return above.
     return system::verify_signature(*key, hash, sig) ?
         error::op_success : error::op_check_sig_verify4;
@@ -1508,9 +1515,9 @@ run_op(const op_iterator& op) NOEXCEPT
         case opcode::codeseparator:
             return op_codeseparator(op);
         case opcode::checksig:
-            return op_check_sig();
+            return op_check_sig(op);
         case opcode::checksigverify:
-            return op_check_sig_verify();
+            return op_check_sig_verify(true);
         case opcode::checkmultisig:
             return op_check_multisig();
         case opcode::checkmultisigverify:
@@ -1601,6 +1608,24 @@ template <typename Stack>
 code interpreter<Stack>::
 connect(const context& state, const transaction& tx,
     const input_iterator& it) NOEXCEPT
+{
+    return connect(state, tx, it, nullptr);
+}
+
+template <typename Stack>
+code interpreter<Stack>::
+connect(const context& state, const transaction& tx,
+    const input_iterator& it, signature_batch& batch) NOEXCEPT
+{
+    return connect(state, tx, it, &batch);
+}
+
+// Input script results are consumed by the prevout script, so the input
+// program does not defer. All subsequent programs must end true.
+template <typename Stack>
+code interpreter<Stack>::
+connect(const context& state, const transaction& tx,
+    const input_iterator& it, signature_batch* batch) NOEXCEPT
 {
     code ec;
     const auto& input = **it;
@@ -1615,6 +1640,9 @@ connect(const context& state, const transaction& tx,
     // Evaluate output script using stack copied from input script evaluation.
     const auto& prevout = input.prevout->script_ptr();
     interpreter out_program(in_program, prevout);
+    if (!is_null(batch))
+        out_program.set_batch(*batch);
+
     if ((ec = out_program.run()))
     {
         return ec;
@@ -1626,7 +1654,7 @@ connect(const context& state, const transaction& tx,
     else if (prevout->is_pay_to_script_hash(state.flags))
     {
         // Because output script pushed script hash program (bip16).
-        if ((ec = connect_embedded(state, tx, it, in_program)))
+        if ((ec = connect_embedded(state, tx, it, in_program, batch)))
             return ec;
     }
     else if (prevout->is_pay_to_witness(state.flags))
@@ -1636,7 +1664,7 @@ connect(const context& state, const transaction& tx,
             return error::dirty_witness;
 
         // Because output script pushed version and witness program (bip141).
-        if ((ec = connect_witness(state, tx, it, *prevout)))
+        if ((ec = connect_witness(state, tx, it, *prevout, batch)))
             return ec;
     }
     else if (!input.witness().stack().empty())
@@ -1654,7 +1682,7 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 template <typename Stack>
 code interpreter<Stack>::connect_embedded(const context& state,
     const transaction& tx, const input_iterator& it,
-    interpreter& in_program) NOEXCEPT
+    interpreter& in_program, signature_batch* batch) NOEXCEPT
 {
     code ec;
     const auto& input = **it;
@@ -1667,6 +1695,9 @@ code interpreter<Stack>::connect_embedded(const context& state,
     // Evaluate embedded script using stack moved from input script.
     const auto prevout = to_shared<script>(in_program.pop(), false);
     interpreter out_program(std::move(in_program), prevout);
+    if (!is_null(batch))
+        out_program.set_batch(*batch);
+
     if ((ec = out_program.run()))
     {
         return ec;
@@ -1681,8 +1712,12 @@ code interpreter<Stack>::connect_embedded(const context& state,
         if (input.script().ops().size() != one)
             return error::dirty_witness;
 
+        // An embedded v1 program is not taproot, so remains reserved (bip341).
+        if (prevout->version() == script_version::one)
+            return error::script_success;
+
         // Because output script pushed version/witness program (bip141).
-        if ((ec = connect_witness(state, tx, it, *prevout)))
+        if ((ec = connect_witness(state, tx, it, *prevout, batch)))
             return ec;
     }
     else if (!input.witness().stack().empty())
@@ -1700,7 +1735,7 @@ BC_POP_WARNING()
 template <typename Stack>
 code interpreter<Stack>::connect_witness(const context& state,
     const transaction& tx, const input_iterator& it,
-    const script& prevout) NOEXCEPT
+    const script& prevout, signature_batch* batch) NOEXCEPT
 {
     const auto& input = **it;
     const auto version = prevout.version();
@@ -1718,6 +1753,9 @@ code interpreter<Stack>::connect_witness(const context& state,
 
             // A defined version indicates bip141 is active.
             interpreter program(tx, it, script, state.flags, version, stack);
+            if (!is_null(batch))
+                program.set_batch(*batch);
+
             if ((ec = program.run()))
                 return ec;
 
@@ -1726,6 +1764,13 @@ code interpreter<Stack>::connect_witness(const context& state,
                 error::stack_false;
         }
 
+        // Taproot (bip341), reserved until active.
+        case script_version::one:
+            if (!script::is_enabled(state.flags, flags::bip341_rule))
+                return error::script_success;
+
+            return connect_taproot(tx, it, prevout, batch);
+
         // These versions are reserved for future extensions (bip141).
         case script_version::reserved:
             return error::script_success;
@@ -1736,6 +1781,68 @@ code interpreter<Stack>::connect_witness(const context& state,
     }
 }
 
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+template <typename Stack>
+code interpreter<Stack>::connect_taproot(const transaction& tx,
+    const input_iterator& it, const script& prevout,
+    signature_batch* batch) NOEXCEPT
+{
+    const auto& stack = (*it)->witness().stack();
+    const auto& program = prevout.witness_program();
+
+    // The annex (if present) is excluded from evaluation (bip341).
+    const auto annex = witness::is_annex_pattern(stack);
+    const auto size = stack.size() - to_int<size_t>(annex);
+
+    // The stack must consist of at least one element (bip341).
+    if (is_zero(size))
+        return error::invalid_witness_stack;
+
+    // Script path spends require tapscript (bip342), which is not evaluated.
+    if (!is_one(size))
+        return error::unsupported_taproot_script;
+
+    // Key path: the signature is 64 bytes, or 65 with explicit sighash type.
+    const auto& endorsement = *stack.front();
+    uint8_t sighash_flags = coverage::hash_default;
+    switch (endorsement.size())
+    {
+        case ec_signature_size:
+            break;
+        case add1(ec_signature_size):
+        {
+            // An explicit default sighash type is invalid (bip341).
+            sighash_flags = endorsement.back();
+            if (sighash_flags == coverage::hash_default)
+                return error::invalid_taproot_signature;
+
+            break;
+        }
+        default:
+            return error::invalid_taproot_signature;
+    }
+
+    hash_digest hash{};
+    if (!tx.signature_hash(hash, it, sighash_flags))
+        return error::invalid_taproot_signature;
+
+    ec_signature signature{};
+    std::copy_n(endorsement.begin(), ec_signature_size, signature.begin());
+
+    // The x-only program accumulates into the batch with ecdsa entries.
+    if (!is_null(batch))
+    {
+        batch->push_back({ program, hash, signature, signature_kind::schnorr });
+        return error::script_success;
+    }
+
+    return verify_schnorr(program, hash, signature) ? error::script_success :
+        error::invalid_taproot_signature;
+}
+
+BC_POP_WARNING()
+
 } // namespace machine
 } // namespace system
 } // namespace libbitcoin
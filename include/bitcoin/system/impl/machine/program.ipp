@@ -130,6 +130,13 @@ pop() NOEXCEPT
     return *pop_chunk_();
 }
 
+template <typename Stack>
+inline void program<Stack>::
+set_batch(signature_batch& batch) NOEXCEPT
+{
+    batch_ = &batch;
+}
+
 // Non-public.
 // ============================================================================
 
@@ -781,6 +788,20 @@ prepare(ec_signature& signature, const data_chunk&, hash_digest& hash,
     return parse_signature(signature, distinguished, bip66);
 }
 
+template <typename Stack>
+inline bool program<Stack>::
+defer(const data_chunk& key, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+    if (is_null(batch_))
+        return false;
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    batch_->push_back({ key, hash, signature, signature_kind::ecdsa });
+    BC_POP_WARNING()
+    return true;
+}
+
 // TODO: use sighash and key to generate signature in sign mode.
 template <typename Stack>
 inline bool program<Stack>::
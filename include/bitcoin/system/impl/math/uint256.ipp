@@ -0,0 +1,355 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MATH_UINT256_IPP
+#define LIBBITCOIN_SYSTEM_MATH_UINT256_IPP
+
+#include <bit>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+// Limb operations are in 64 bit words, with 32 bit halves for multiplication
+// and division by 32 bit values, so that there is no dependency on 128 bit
+// integrals or intrinsics and all operations are constexpr.
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+constexpr uint256::uint256() NOEXCEPT
+  : words_{}
+{
+}
+
+constexpr uint256::uint256(uint64_t value) NOEXCEPT
+  : words_{ value, 0, 0, 0 }
+{
+}
+
+constexpr uint256::uint256(const words_t& words) NOEXCEPT
+  : words_(words)
+{
+}
+
+// Backend limbs are 64 or 32 bits, depending on platform int128 support.
+inline uint256::uint256(const uint256_t& value) NOEXCEPT
+  : words_{}
+{
+    using limb_t = boost::multiprecision::limb_type;
+    constexpr auto limb_bits = sizeof(limb_t) * 8u;
+    const auto& backend = value.backend();
+    const auto data = backend.limbs();
+
+    for (size_t limb = 0; limb < backend.size(); ++limb)
+    {
+        const auto bit = limb * limb_bits;
+        words_[bit / 64u] |= static_cast<uint64_t>(data[limb]) << (bit % 64u);
+    }
+}
+
+// Conversions.
+// ----------------------------------------------------------------------------
+
+constexpr uint256 uint256::from_little_endian(const bytes_t& data) NOEXCEPT
+{
+    words_t words{};
+    for (size_t byte = 0; byte < data.size(); ++byte)
+        words[byte / 8u] |= static_cast<uint64_t>(data[byte]) <<
+            ((byte % 8u) * 8u);
+
+    return { words };
+}
+
+constexpr uint256::bytes_t uint256::to_little_endian() const NOEXCEPT
+{
+    bytes_t data{};
+    for (size_t byte = 0; byte < data.size(); ++byte)
+        data[byte] = static_cast<uint8_t>(words_[byte / 8u] >>
+            ((byte % 8u) * 8u));
+
+    return data;
+}
+
+inline uint256_t uint256::to_uintx() const NOEXCEPT
+{
+    using limb_t = boost::multiprecision::limb_type;
+    constexpr auto limb_bits = sizeof(limb_t) * 8u;
+    constexpr auto count = bits / limb_bits;
+
+    uint256_t out{};
+    auto& backend = out.backend();
+    backend.resize(count, count);
+    const auto data = backend.limbs();
+
+    for (size_t limb = 0; limb < count; ++limb)
+    {
+        const auto bit = limb * limb_bits;
+        data[limb] = static_cast<limb_t>(words_[bit / 64u] >> (bit % 64u));
+    }
+
+    // Trims high zero limbs, as required by the backend.
+    backend.normalize();
+    return out;
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+constexpr const uint256::words_t& uint256::words() const NOEXCEPT
+{
+    return words_;
+}
+
+constexpr size_t uint256::width() const NOEXCEPT
+{
+    for (auto word = limbs; word > 0u; --word)
+        if (words_[word - 1u] != 0u)
+            return (word - 1u) * 64u +
+                static_cast<size_t>(std::bit_width(words_[word - 1u]));
+
+    return 0;
+}
+
+constexpr uint256::operator bool() const NOEXCEPT
+{
+    return (words_[0] | words_[1] | words_[2] | words_[3]) != 0u;
+}
+
+// Operators.
+// ----------------------------------------------------------------------------
+
+constexpr uint256 uint256::operator~() const NOEXCEPT
+{
+    return { { ~words_[0], ~words_[1], ~words_[2], ~words_[3] } };
+}
+
+constexpr uint256& uint256::operator++() NOEXCEPT
+{
+    for (auto& word: words_)
+        if (++word != 0u)
+            break;
+
+    return *this;
+}
+
+constexpr uint256& uint256::operator+=(const uint256& value) NOEXCEPT
+{
+    uint64_t carry{};
+    for (size_t word = 0; word < limbs; ++word)
+    {
+        const auto sum = words_[word] + value.words_[word];
+        const auto total = sum + carry;
+        carry = ((sum < words_[word]) || (total < sum)) ? 1u : 0u;
+        words_[word] = total;
+    }
+
+    return *this;
+}
+
+constexpr uint256& uint256::operator-=(const uint256& value) NOEXCEPT
+{
+    uint64_t borrow{};
+    for (size_t word = 0; word < limbs; ++word)
+    {
+        const auto difference = words_[word] - value.words_[word];
+        const auto total = difference - borrow;
+        borrow = ((difference > words_[word]) || (total > difference)) ? 1u : 0u;
+        words_[word] = total;
+    }
+
+    return *this;
+}
+
+constexpr uint256& uint256::operator<<=(size_t shift) NOEXCEPT
+{
+    if (shift >= bits)
+        return *this = {};
+
+    const auto offset = shift / 64u;
+    const auto bit = shift % 64u;
+
+    for (auto word = limbs; word > 0u; --word)
+    {
+        const auto to = word - 1u;
+        if (to < offset)
+        {
+            words_[to] = 0;
+            continue;
+        }
+
+        const auto from = to - offset;
+        words_[to] = words_[from] << bit;
+        if (!is_zero(bit) && !is_zero(from))
+            words_[to] |= words_[from - 1u] >> (64u - bit);
+    }
+
+    return *this;
+}
+
+constexpr uint256& uint256::operator>>=(size_t shift) NOEXCEPT
+{
+    if (shift >= bits)
+        return *this = {};
+
+    const auto offset = shift / 64u;
+    const auto bit = shift % 64u;
+
+    for (size_t to = 0; to < limbs; ++to)
+    {
+        const auto from = to + offset;
+        if (from >= limbs)
+        {
+            words_[to] = 0;
+            continue;
+        }
+
+        words_[to] = words_[from] >> bit;
+        if (!is_zero(bit) && from + 1u < limbs)
+            words_[to] |= words_[from + 1u] << (64u - bit);
+    }
+
+    return *this;
+}
+
+constexpr uint256& uint256::operator*=(uint32_t value) NOEXCEPT
+{
+    constexpr uint64_t mask = 0xffffffff;
+    uint64_t carry{};
+
+    // Each 32x32 product plus 32 bit carry fits in 64 bits.
+    for (auto& word: words_)
+    {
+        const auto low = (word & mask) * value + carry;
+        const auto high = (word >> 32u) * value + (low >> 32u);
+        word = (high << 32u) | (low & mask);
+        carry = high >> 32u;
+    }
+
+    return *this;
+}
+
+constexpr uint256& uint256::operator/=(uint32_t value) NOEXCEPT
+{
+    if (is_zero(value))
+        return *this = {};
+
+    constexpr uint64_t mask = 0xffffffff;
+    uint64_t remainder{};
+
+    // Each remainder (< value) shifted in with a 32 bit half fits in 64 bits.
+    for (auto word = limbs; word > 0u; --word)
+    {
+        auto& limb = words_[word - 1u];
+        const auto high = (remainder << 32u) | (limb >> 32u);
+        remainder = high % value;
+        const auto low = (remainder << 32u) | (limb & mask);
+        remainder = low % value;
+        limb = ((high / value) << 32u) | (low / value);
+    }
+
+    return *this;
+}
+
+// Shift-subtract over quotient width only. For header proof the divisor is
+// a target, so the quotient is generally small and this is short.
+constexpr uint256& uint256::operator/=(const uint256& value) NOEXCEPT
+{
+    if (!value || *this < value)
+        return *this = {};
+
+    auto shift = width() - value.width();
+    auto divisor = value << shift;
+    uint256 quotient{};
+
+    for (++shift; shift > 0u; --shift)
+    {
+        quotient <<= 1u;
+        if (*this >= divisor)
+        {
+            *this -= divisor;
+            quotient.words_[0] |= 1u;
+        }
+
+        divisor >>= 1u;
+    }
+
+    return *this = quotient;
+}
+
+// protected
+constexpr int uint256::compare(const uint256& left,
+    const uint256& right) NOEXCEPT
+{
+    for (auto word = limbs; word > 0u; --word)
+    {
+        const auto lhs = left.words_[word - 1u];
+        const auto rhs = right.words_[word - 1u];
+        if (lhs != rhs)
+            return lhs < rhs ? -1 : 1;
+    }
+
+    return 0;
+}
+
+// Binary operators.
+// ----------------------------------------------------------------------------
+
+constexpr uint256 operator+(uint256 left, const uint256& right) NOEXCEPT
+{
+    return left += right;
+}
+
+constexpr uint256 operator-(uint256 left, const uint256& right) NOEXCEPT
+{
+    return left -= right;
+}
+
+constexpr uint256 operator<<(uint256 left, size_t shift) NOEXCEPT
+{
+    return left <<= shift;
+}
+
+constexpr uint256 operator>>(uint256 left, size_t shift) NOEXCEPT
+{
+    return left >>= shift;
+}
+
+constexpr uint256 operator*(uint256 left, uint32_t right) NOEXCEPT
+{
+    return left *= right;
+}
+
+constexpr uint256 operator/(uint256 left, uint32_t right) NOEXCEPT
+{
+    return left /= right;
+}
+
+constexpr uint256 operator/(uint256 left, const uint256& right) NOEXCEPT
+{
+    return left /= right;
+}
+
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -19,7 +19,6 @@
 #ifndef LIBBITCOIN_SYSTEM_RADIX_BASE_58_IPP
 #define LIBBITCOIN_SYSTEM_RADIX_BASE_58_IPP
 
-#include <algorithm>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 
@@ -29,12 +28,7 @@ namespace system {
 template <size_t Size>
 bool decode_base58(data_array<Size>& out, const std::string& in) NOEXCEPT
 {
-    data_chunk data{};
-    if (!decode_base58(data, in) || (data.size() != Size))
-        return false;
-
-    std::copy(data.begin(), data.end(), out.begin());
-    return true;
+    return decode_base58(out.data(), Size, in);
 }
 
 // TODO: determine if the sizing function is always accurate.
@@ -39,6 +39,13 @@ sha256x2_writer<OStream>::sha256x2_writer(OStream& sink) NOEXCEPT
 {
 }
 
+template <typename OStream>
+sha256x2_writer<OStream>::sha256x2_writer(OStream& sink,
+    const sha256::state_t& state, size_t blocks) NOEXCEPT
+  : byte_writer<OStream>(sink), context_{ state, blocks }
+{
+}
+
 template <typename OStream>
 sha256x2_writer<OStream>::~sha256x2_writer() NOEXCEPT
 {
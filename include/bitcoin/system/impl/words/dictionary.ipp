@@ -20,7 +20,9 @@
 #define LIBBITCOIN_SYSTEM_WORDS_DICTIONARY_IPP
 
 #include <algorithm>
+#include <cstdlib>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -32,11 +34,130 @@ namespace libbitcoin {
 namespace system {
 namespace words {
 
-// Ensure that dictionary word lists remain POD types.
-// C++20: std::is_pod deprecated, implied by is_trivial + is_standard_layout.
-static_assert(std::is_trivial<dictionary<1>::words>(), "performance");
+// Ensure that dictionary word lists remain trivially copyable standard layout
+// types (not trivial, as there is no public default constructor).
+static_assert(std::is_trivially_copyable<dictionary<1>::words>(), "performance");
 static_assert(std::is_standard_layout<dictionary<1>::words>(), "performance");
 
+// Words are constructible only by hash(), so every table is hashed.
+static_assert(!std::is_aggregate_v<dictionary<1>::words>);
+static_assert(!std::is_default_constructible_v<dictionary<1>::words>);
+static_assert(!std::is_constructible_v<dictionary<1>::words, bool,
+    const dictionary<1>::list&>);
+
+// Perfect hash.
+// ----------------------------------------------------------------------------
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+template <size_t Size>
+constexpr uint64_t dictionary<Size>::mix(uint64_t key) NOEXCEPT
+{
+    // Murmur3 finalizer (bijective avalanche).
+    key = (key ^ shift_right(key, 33)) * 0xff51afd7ed558ccd_u64;
+    key = (key ^ shift_right(key, 33)) * 0xc4ceb9fe1a85ec53_u64;
+    return key ^ shift_right(key, 33);
+}
+
+template <size_t Size>
+constexpr uint64_t dictionary<Size>::fingerprint(
+    std::string_view word) NOEXCEPT
+{
+    // FNV-1a over utf8 bytes, mixed as it diffuses poorly for short words.
+    uint64_t key = 0xcbf29ce484222325_u64;
+    for (const auto character: word)
+        key = (key ^ static_cast<uint8_t>(character)) * 0x00000100000001b3_u64;
+
+    return mix(key);
+}
+
+template <size_t Size>
+constexpr size_t dictionary<Size>::position(uint64_t key,
+    size_t seed) NOEXCEPT
+{
+    // Seed is mixed into the key, so each seed is an independent placement.
+    return possible_narrow_cast<size_t>(
+        mix(key ^ (seed * 0x9e3779b97f4a7c15_u64)) % Size);
+}
+
+template <size_t Size>
+CONSTEVAL typename dictionary<Size>::words
+dictionary<Size>::hash(bool sorted, const list& word) NOEXCEPT
+{
+    words out{ sorted, word };
+    std_array<uint64_t, Size> keys{};
+    std_array<size_t, add1(buckets)> starts{};
+    std_array<size_t, Size> members{};
+    std_array<size_t, Size> slots{};
+    std_array<bool, Size> used{};
+
+    // Fingerprint each word and count the words of each bucket.
+    for (size_t index = 0; index < Size; ++index)
+    {
+        keys[index] = fingerprint(word[index]);
+        ++starts[add1(keys[index] % buckets)];
+    }
+
+    // Group words by bucket (counting sort), tracking the largest bucket.
+    size_t largest{};
+    for (size_t bucket = 0; bucket < buckets; ++bucket)
+    {
+        largest = std::max(largest, starts[add1(bucket)]);
+        starts[add1(bucket)] += starts[bucket];
+    }
+
+    auto cursor = starts;
+    for (size_t index = 0; index < Size; ++index)
+        members[cursor[keys[index] % buckets]++] = index;
+
+    // Place largest buckets first, while most slots are free. For each bucket
+    // search for the first seed that maps all of its words to free slots.
+    for (auto count = largest; !is_zero(count); --count)
+    {
+        for (size_t bucket = 0; bucket < buckets; ++bucket)
+        {
+            const auto start = starts[bucket];
+            if (starts[add1(bucket)] - start != count)
+                continue;
+
+            size_t seed{};
+            for (auto placed = false; !placed; ++seed)
+            {
+                // Unreachable for any reasonable word list (not constexpr).
+                if (seed > max_uint16)
+                    std::abort();
+
+                placed = true;
+                for (size_t member = 0; placed && member < count; ++member)
+                {
+                    const auto slot = position(keys[members[start + member]],
+                        seed);
+
+                    placed = !used[slot];
+                    for (size_t prior = 0; placed && prior < member; ++prior)
+                        placed = slots[prior] != slot;
+
+                    slots[member] = slot;
+                }
+            }
+
+            out.seed[bucket] = narrow_cast<uint16_t>(sub1(seed));
+            for (size_t member = 0; member < count; ++member)
+            {
+                used[slots[member]] = true;
+                out.slot[slots[member]] = narrow_cast<uint16_t>(
+                    members[start + member]);
+            }
+        }
+    }
+
+    return out;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
 // Constructor.
 // ----------------------------------------------------------------------------
 
@@ -84,17 +205,26 @@ string_list dictionary<Size>::at(const search& indexes) const NOEXCEPT
 }
 
 template <size_t Size>
-int32_t dictionary<Size>::index(const std::string& word) const NOEXCEPT
+int32_t dictionary<Size>::index(std::string_view word) const NOEXCEPT
 {
-    // Dictionary sort is configured on each dictionary, verified by tests.
-    // Dictionary is char* elements but using std::string (word) for compares.
-    if (words_.sorted)
-        return possible_narrow_cast<int32_t>(binary_search(words_.word, word));
-
-    // std::find returns first match, though words should be unique.
-    const auto it = std::find(words_.word.begin(), words_.word.end(), word);
-    return it == words_.word.end() ? -1 : 
-        possible_narrow_cast<int32_t>(std::distance(words_.word.begin(), it));
+    if constexpr (is_zero(Size))
+    {
+        return -1;
+    }
+    else
+    {
+        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+        BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+        // Any word maps to exactly one slot, which is confirmed by compare.
+        const auto key = fingerprint(word);
+        const auto seed = words_.seed[key % buckets];
+        const auto index = words_.slot[position(key, seed)];
+        return word == words_.word[index] ? index : -1;
+
+        BC_POP_WARNING()
+        BC_POP_WARNING()
+    }
 }
 
 template <size_t Size>
@@ -104,17 +234,18 @@ dictionary<Size>::index(const string_list& words) const NOEXCEPT
     dictionary<Size>::result out(words.size());
 
     // std::transform can be parallel but maintains order.
+    // Words are viewed in place, no string is constructed or compared.
     std::transform(words.begin(), words.end(), out.begin(),
         [&](const std::string& word)
         {
-            return index(word);
+            return index(std::string_view{ word });
         });
 
     return out;
 }
 
 template <size_t Size>
-bool dictionary<Size>::contains(const std::string& word) const NOEXCEPT
+bool dictionary<Size>::contains(std::string_view word) const NOEXCEPT
 {
     return index(word) >= 0;
 }
@@ -126,7 +257,7 @@ bool dictionary<Size>::contains(const string_list& words) const NOEXCEPT
     return std::all_of(words.begin(), words.end(),
         [&](const std::string& word)
         {
-            return contains(word);
+            return contains(std::string_view{ word });
         });
 }
 
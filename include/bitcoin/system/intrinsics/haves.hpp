@@ -57,6 +57,16 @@ BC_PUSH_WARNING(USE_CONSTEXPR_FOR_FUNCTION)
 #else
     constexpr auto with_shani = false;
 #endif
+#if defined(HAVE_AESNI)
+    constexpr auto with_aesni = true;
+#else
+    constexpr auto with_aesni = false;
+#endif
+#if defined(HAVE_VAES)
+    constexpr auto with_vaes = true;
+#else
+    constexpr auto with_vaes = false;
+#endif
 #if defined(HAVE_NEON)
     constexpr auto with_neon = true;
 #else
@@ -71,6 +81,7 @@ namespace cpu1_0
     constexpr auto leaf = 1;
     constexpr auto subleaf = 0;
     constexpr auto sse41_ecx_bit = 19;
+    constexpr auto aes_ecx_bit = 25;
     constexpr auto xsave_ecx_bit = 27;
     constexpr auto avx_ecx_bit = 28;
 }
@@ -84,6 +95,7 @@ namespace cpu7_0
     ////constexpr auto avx512f_ebx_bit = 16;
     constexpr auto avx512bw_ebx_bit = 30;
     constexpr auto shani_ebx_bit = 29;
+    constexpr auto vaes_ecx_bit = 9;
 }
 
 namespace xcr0
@@ -111,6 +123,14 @@ inline bool try_shani() NOEXCEPT
         && get_bit<cpu7_0::shani_ebx_bit>(ebx);     // SHA-NI
 }
 
+inline bool try_aesni() NOEXCEPT
+{
+    uint32_t eax{}, ebx{}, ecx{}, edx{};
+    return get_cpu(eax, ebx, ecx, edx, cpu1_0::leaf, cpu1_0::subleaf)
+        && get_bit<cpu1_0::sse41_ecx_bit>(ecx)      // SSE4.1
+        && get_bit<cpu1_0::aes_ecx_bit>(ecx);       // AES-NI
+}
+
 inline bool try_avx512() NOEXCEPT
 {
     uint64_t extended{};
@@ -127,6 +147,15 @@ inline bool try_avx512() NOEXCEPT
         && get_bit<cpu7_0::avx512bw_ebx_bit>(ebx);  // AVX512BW
 }
 
+inline bool try_vaes() NOEXCEPT
+{
+    uint32_t eax{}, ebx{}, ecx{}, edx{};
+    return try_aesni()
+        && try_avx512()
+        && get_cpu(eax, ebx, ecx, edx, cpu7_0::leaf, cpu7_0::subleaf)
+        && get_bit<cpu7_0::vaes_ecx_bit>(ecx);      // VAES
+}
+
 inline bool try_avx2() NOEXCEPT
 {
     uint64_t extended{};
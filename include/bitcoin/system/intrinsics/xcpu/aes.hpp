@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_INTRINSICS_XCPU_AES_HPP
+#define LIBBITCOIN_SYSTEM_INTRINSICS_XCPU_AES_HPP
+
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/intrinsics/xcpu/defines.hpp>
+#include <bitcoin/system/intrinsics/xcpu/functional_128.hpp>
+#include <bitcoin/system/intrinsics/xcpu/functional_512.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// HAVE_AESNI implies HAVE_SSE41, which defines xint128_t (__m128i).
+#if defined(HAVE_AESNI)
+
+// AES (128 bit block, one block per lane)
+// ----------------------------------------------------------------------------
+
+INLINE xint128_t aes_encrypt(xint128_t a, xint128_t key) NOEXCEPT
+{
+    // "Perform one round of an AES encryption flow on data (state) in a using
+    // the round key in key, and store the result in destination." - Intel
+    return mm_aesenc_si128(a, key);
+}
+
+INLINE xint128_t aes_encrypt_last(xint128_t a, xint128_t key) NOEXCEPT
+{
+    // "Perform the last round of an AES encryption flow on data (state) in a
+    // using the round key in key, and store the result in destination."
+    // - Intel
+    return mm_aesenclast_si128(a, key);
+}
+
+INLINE xint128_t aes_decrypt(xint128_t a, xint128_t key) NOEXCEPT
+{
+    // "Perform one round of an AES decryption flow on data (state) in a using
+    // the round key in key, and store the result in destination." - Intel
+    return mm_aesdec_si128(a, key);
+}
+
+INLINE xint128_t aes_decrypt_last(xint128_t a, xint128_t key) NOEXCEPT
+{
+    // "Perform the last round of an AES decryption flow on data (state) in a
+    // using the round key in key, and store the result in destination."
+    // - Intel
+    return mm_aesdeclast_si128(a, key);
+}
+
+INLINE xint128_t aes_inverse_mix(xint128_t key) NOEXCEPT
+{
+    // "Perform the InvMixColumns transformation on a and store the result in
+    // destination." - Intel
+    return mm_aesimc_si128(key);
+}
+
+template <int Round,
+    if_not_lesser<Round, 0> = true, if_not_greater<Round, 255> = true>
+INLINE xint128_t aes_key_assist(xint128_t key) NOEXCEPT
+{
+    // "Assist in expanding the AES cipher key by computing steps towards
+    // generating a round key for encryption cipher using data from a and an
+    // 8-bit round constant specified in imm8, and store the result in
+    // destination." - Intel
+    return mm_aeskeygenassist_si128(key, Round);
+}
+
+#endif
+
+// HAVE_VAES implies HAVE_AVX512, which defines xint512_t (__m512i).
+#if defined(HAVE_VAES)
+
+// AES (128 bit block, four blocks per lane)
+// ----------------------------------------------------------------------------
+
+INLINE xint512_t aes_encrypt(xint512_t a, xint512_t key) NOEXCEPT
+{
+    return mm512_aesenc_epi128(a, key);
+}
+
+INLINE xint512_t aes_encrypt_last(xint512_t a, xint512_t key) NOEXCEPT
+{
+    return mm512_aesenclast_epi128(a, key);
+}
+
+INLINE xint512_t aes_decrypt(xint512_t a, xint512_t key) NOEXCEPT
+{
+    return mm512_aesdec_epi128(a, key);
+}
+
+INLINE xint512_t aes_decrypt_last(xint512_t a, xint512_t key) NOEXCEPT
+{
+    return mm512_aesdeclast_epi128(a, key);
+}
+
+INLINE xint512_t aes_broadcast(xint128_t key) NOEXCEPT
+{
+    // Copy the 128 bit round key to each of the four 128 bit lanes.
+    return mm512_broadcast_i32x4(key);
+}
+
+#endif
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -344,4 +344,38 @@ BC_POP_WARNING()
     #define mm_sha256rnds2_epu32(a, b, k)       _mm_sha256rnds2_epu32(a, b, k)
 #endif
 
+#if !defined(HAVE_AESNI)
+    #define mm_aesenc_si128(a, key)             {}
+    #define mm_aesenclast_si128(a, key)         {}
+    #define mm_aesdec_si128(a, key)             {}
+    #define mm_aesdeclast_si128(a, key)         {}
+    #define mm_aesimc_si128(a)                  {}
+    #define mm_aeskeygenassist_si128(a, R)      {}
+    #define mm_shuffle_epi32(a, mask)           {}
+    #define mm_slli_si128(a, B)                 {}
+#else
+    #define mm_aesenc_si128(a, key)             _mm_aesenc_si128(a, key)
+    #define mm_aesenclast_si128(a, key)         _mm_aesenclast_si128(a, key)
+    #define mm_aesdec_si128(a, key)             _mm_aesdec_si128(a, key)
+    #define mm_aesdeclast_si128(a, key)         _mm_aesdeclast_si128(a, key)
+    #define mm_aesimc_si128(a)                  _mm_aesimc_si128(a)
+    #define mm_aeskeygenassist_si128(a, R)      _mm_aeskeygenassist_si128(a, R)
+    #define mm_shuffle_epi32(a, mask)           _mm_shuffle_epi32(a, mask)
+    #define mm_slli_si128(a, B)                 _mm_slli_si128(a, B)
+#endif
+
+#if !defined(HAVE_VAES)
+    #define mm512_aesenc_epi128(a, key)         {}
+    #define mm512_aesenclast_epi128(a, key)     {}
+    #define mm512_aesdec_epi128(a, key)         {}
+    #define mm512_aesdeclast_epi128(a, key)     {}
+    #define mm512_broadcast_i32x4(a)            {}
+#else
+    #define mm512_aesenc_epi128(a, key)         _mm512_aesenc_epi128(a, key)
+    #define mm512_aesenclast_epi128(a, key)     _mm512_aesenclast_epi128(a, key)
+    #define mm512_aesdec_epi128(a, key)         _mm512_aesdec_epi128(a, key)
+    #define mm512_aesdeclast_epi128(a, key)     _mm512_aesdeclast_epi128(a, key)
+    #define mm512_broadcast_i32x4(a)            _mm512_broadcast_i32x4(a)
+#endif
+
 #endif
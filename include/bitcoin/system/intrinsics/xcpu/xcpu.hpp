@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_INTRINSICS_XCPU_XCPU_HPP
 #define LIBBITCOIN_SYSTEM_INTRINSICS_XCPU_XCPU_HPP
 
+#include <bitcoin/system/intrinsics/xcpu/aes.hpp>
 #include <bitcoin/system/intrinsics/xcpu/cpuid.hpp>
 #include <bitcoin/system/intrinsics/xcpu/defines.hpp>
 #include <bitcoin/system/intrinsics/xcpu/functional_128.hpp>
@@ -55,14 +55,30 @@ public:
     static code connect(const context& state, const transaction& tx,
         const input_iterator& it) NOEXCEPT;
 
+    /// Connect with terminal signature checks deferred into batch. Success
+    /// is conditional upon subsequent verify_signatures(batch) success.
+    static code connect(const context& state, const transaction& tx,
+        const input_iterator& it, signature_batch& batch) NOEXCEPT;
+
 protected:
+    /// Connect with optional signature batch.
+    static code connect(const context& state, const transaction& tx,
+        const input_iterator& it, signature_batch* batch) NOEXCEPT;
+
     /// Embedded script handler.
     static code connect_embedded(const context& state, const transaction& tx,
-        const input_iterator& it, interpreter& in_program) NOEXCEPT;
+        const input_iterator& it, interpreter& in_program,
+        signature_batch* batch) NOEXCEPT;
 
     /// Witnessed script handler.
     static code connect_witness(const context& state, const transaction& tx,
-        const input_iterator& it, const script& prevout) NOEXCEPT;
+        const input_iterator& it, const script& prevout,
+        signature_batch* batch) NOEXCEPT;
+
+    /// Taproot (witness v1) handler, key path spend only.
+    static code connect_taproot(const transaction& tx,
+        const input_iterator& it, const script& prevout,
+        signature_batch* batch) NOEXCEPT;
 
     /// Operation disatch.
     error::op_error_t run_op(const op_iterator& op) NOEXCEPT;
@@ -148,8 +164,8 @@ protected:
     inline error::op_error_t op_hash160() NOEXCEPT;
     inline error::op_error_t op_hash256() NOEXCEPT;
     inline error::op_error_t op_codeseparator(const op_iterator& op) NOEXCEPT;
-    inline error::op_error_t op_check_sig_verify() NOEXCEPT;
-    inline error::op_error_t op_check_sig() NOEXCEPT;
+    inline error::op_error_t op_check_sig_verify(bool defer) NOEXCEPT;
+    inline error::op_error_t op_check_sig(const op_iterator& op) NOEXCEPT;
     inline error::op_error_t op_check_multisig_verify() NOEXCEPT;
     inline error::op_error_t op_check_multisig() NOEXCEPT;
     inline error::op_error_t op_check_locktime_verify() const NOEXCEPT;
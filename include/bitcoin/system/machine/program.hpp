@@ -68,6 +68,10 @@ public:
     /// Transaction must pop top input stack element (bip16).
     inline const data_chunk& pop() NOEXCEPT;
 
+    /// Defer terminal signature verification into batch (caller verifies).
+    /// Valid only for a program whose result is required true (not input).
+    inline void set_batch(signature_batch& batch) NOEXCEPT;
+
 protected:
     INLINE static bool equal_chunks(const stack_variant& left,
         const stack_variant& right) NOEXCEPT;
@@ -163,6 +167,10 @@ protected:
     inline bool prepare(ec_signature& signature, const data_chunk& key,
         hash_digest& hash, const chunk_xptr& endorsement) const NOEXCEPT;
 
+    /// Append to signature batch if set, otherwise false (verify now).
+    inline bool defer(const data_chunk& key, const hash_digest& hash,
+        const ec_signature& signature) NOEXCEPT;
+
     /// Prepare signature, with caching for multisig with same sighash flags.
     inline bool prepare(ec_signature& signature, const data_chunk& key,
         hash_cache& cache, uint8_t& sighash_flags, const data_chunk& endorsement,
@@ -209,6 +217,9 @@ private:
 
     // Condition stack optimization.
     size_t negative_condition_count_{};
+
+    // Deferred signature verification.
+    signature_batch* batch_{};
 };
 
 } // namespace machine
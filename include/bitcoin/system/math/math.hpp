@@ -33,6 +33,7 @@
 #include <bitcoin/system/math/power.hpp>
 #include <bitcoin/system/math/rotate.hpp>
 #include <bitcoin/system/math/sign.hpp>
+#include <bitcoin/system/math/uint256.hpp>
 
 // Inclusion dependencies:
 // cast           ->
@@ -49,6 +50,7 @@
 // logarithm      -> sign, cast, overflow, division  (for ceiling/floor opts)
 // addition       -> sign, cast, overflow, limits    (for ceiling/floor opts)
 // multiplication ->       cast, overflow, limits    (for ceiling opts)
+// uint256        ->
 
 // sign/cast/overflow should not call any other math libs and are safe from
 // all others. bits/bytes should otherwise call only log. Otherwise only:
@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MATH_UINT256_HPP
+#define LIBBITCOIN_SYSTEM_MATH_UINT256_HPP
+
+#include <array>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Fixed-width 256 bit unsigned integer of four 64 bit limbs (low first).
+/// Arithmetic wraps modulo 2^256, matching uint256_t (unchecked) results.
+/// Converts to and from uint256_t and little-endian (hash) bytes. This is not
+/// a uintx_t (uint256_t remains the boost type), it is used internally for
+/// target, proof and cumulative work computation, with public interfaces
+/// converting to uint256_t.
+class uint256
+{
+public:
+    static constexpr size_t limbs = 4;
+    static constexpr size_t bits = limbs * 64u;
+    using words_t = std::array<uint64_t, limbs>;
+    using bytes_t = std::array<uint8_t, limbs * sizeof(uint64_t)>;
+
+    /// Constructors.
+    /// -----------------------------------------------------------------------
+
+    constexpr uint256() NOEXCEPT;
+    constexpr uint256(uint64_t value) NOEXCEPT;
+    constexpr uint256(const words_t& words) NOEXCEPT;
+    uint256(const uint256_t& value) NOEXCEPT;
+
+    /// Conversions.
+    /// -----------------------------------------------------------------------
+
+    /// Little-endian bytes, as in hash_digest to_uintx/from_uintx.
+    static constexpr uint256 from_little_endian(const bytes_t& data) NOEXCEPT;
+    constexpr bytes_t to_little_endian() const NOEXCEPT;
+
+    /// Equivalent uint256_t.
+    uint256_t to_uintx() const NOEXCEPT;
+
+    /// Properties.
+    /// -----------------------------------------------------------------------
+
+    constexpr const words_t& words() const NOEXCEPT;
+
+    /// Count of significant bits, floored_log2(value) + 1 (zero for zero).
+    constexpr size_t width() const NOEXCEPT;
+
+    constexpr explicit operator bool() const NOEXCEPT;
+
+    /// Operators.
+    /// -----------------------------------------------------------------------
+
+    constexpr uint256 operator~() const NOEXCEPT;
+    constexpr uint256& operator++() NOEXCEPT;
+    constexpr uint256& operator+=(const uint256& value) NOEXCEPT;
+    constexpr uint256& operator-=(const uint256& value) NOEXCEPT;
+    constexpr uint256& operator<<=(size_t shift) NOEXCEPT;
+    constexpr uint256& operator>>=(size_t shift) NOEXCEPT;
+    constexpr uint256& operator*=(uint32_t value) NOEXCEPT;
+    constexpr uint256& operator/=(uint32_t value) NOEXCEPT;
+
+    /// Division by zero returns zero (uint256_t throws).
+    constexpr uint256& operator/=(const uint256& value) NOEXCEPT;
+
+    friend constexpr bool operator==(const uint256& left,
+        const uint256& right) NOEXCEPT
+    {
+        return left.words_ == right.words_;
+    }
+
+    friend constexpr bool operator!=(const uint256& left,
+        const uint256& right) NOEXCEPT
+    {
+        return !(left == right);
+    }
+
+    friend constexpr bool operator<(const uint256& left,
+        const uint256& right) NOEXCEPT
+    {
+        return compare(left, right) < 0;
+    }
+
+    friend constexpr bool operator>(const uint256& left,
+        const uint256& right) NOEXCEPT
+    {
+        return compare(left, right) > 0;
+    }
+
+    friend constexpr bool operator<=(const uint256& left,
+        const uint256& right) NOEXCEPT
+    {
+        return compare(left, right) <= 0;
+    }
+
+    friend constexpr bool operator>=(const uint256& left,
+        const uint256& right) NOEXCEPT
+    {
+        return compare(left, right) >= 0;
+    }
+
+protected:
+    static constexpr int compare(const uint256& left,
+        const uint256& right) NOEXCEPT;
+
+private:
+    words_t words_;
+};
+
+/// Binary operators (by value).
+constexpr uint256 operator+(uint256 left, const uint256& right) NOEXCEPT;
+constexpr uint256 operator-(uint256 left, const uint256& right) NOEXCEPT;
+constexpr uint256 operator<<(uint256 left, size_t shift) NOEXCEPT;
+constexpr uint256 operator>>(uint256 left, size_t shift) NOEXCEPT;
+constexpr uint256 operator*(uint256 left, uint32_t right) NOEXCEPT;
+constexpr uint256 operator/(uint256 left, uint32_t right) NOEXCEPT;
+constexpr uint256 operator/(uint256 left, const uint256& right) NOEXCEPT;
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/math/uint256.ipp>
+
+#endif
@@ -211,11 +211,13 @@
     #define std_all_of(p, b, e, l) std::all_of((p), (b), (e), (l))
     #define std_for_each(p, b, e, l) std::for_each((p), (b), (e), (l))
     #define std_transform(p, b, e, t, l) std::transform((p), (b), (e), (t), (l))
+    #define std_sort(p, b, e) std::sort((p), (b), (e))
 #else
     #define std_any_of(p, b, e, l) std::any_of((b), (e), (l))
     #define std_all_of(p, b, e, l) std::all_of((b), (e), (l))
     #define std_for_each(p, b, e, l) std::for_each((b), (e), (l))
     #define std_transform(p, b, e, t, l) std::transform((b), (e), (t), (l))
+    #define std_sort(p, b, e) std::sort((b), (e))
 #endif
 
 /// C++20 (partial)
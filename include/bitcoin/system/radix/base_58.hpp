@@ -29,7 +29,13 @@ namespace system {
 BC_API bool is_base58(const char character) NOEXCEPT;
 BC_API bool is_base58(const std::string& text) NOEXCEPT;
 
-/// Converts a base58 string to a number of bytes.
+/// Maximum encoded length of a number of bytes, log(256) / log(58) rounded up.
+constexpr size_t base58_size(size_t bytes) NOEXCEPT
+{
+    return bytes * 138u / 100u + 1u;
+}
+
+/// Converts a base58 string to a number of bytes (without allocation).
 /// False if the input is malformed, or the wrong length.
 template <size_t Size>
 bool decode_base58(data_array<Size>& out, const std::string& in) NOEXCEPT;
@@ -41,10 +47,20 @@ data_array<Size * 733 / 1000> base58_array(const char(&string)[Size]) NOEXCEPT;
 /// Encode data as base58.
 BC_API std::string encode_base58(const data_slice& unencoded) NOEXCEPT;
 
+/// Encode data as base58 to out (without allocation or null terminator).
+/// Returns encoded length, zero if size is insufficient (see base58_size).
+BC_API size_t encode_base58(char* out, size_t size,
+    const data_slice& unencoded) NOEXCEPT;
+
 /// Attempt to decode base58 data.
 /// False if the input contains non-base58 characters.
 BC_API bool decode_base58(data_chunk& out, const std::string& in) NOEXCEPT;
 
+/// Attempt to decode base58 data to exactly size bytes (without allocation).
+/// False if the input contains non-base58 characters or is not size bytes.
+BC_API bool decode_base58(uint8_t* out, size_t size,
+    const std::string& in) NOEXCEPT;
+
 } // namespace system
 } // namespace libbitcoin
 
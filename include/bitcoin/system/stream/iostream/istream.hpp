@@ -28,8 +28,9 @@ namespace system {
 /// Support for high level input operations on a byte buffer.
 /// Cannot derive from istream and cannot make both share an interface.
 /// So this is duck-typed to the subset of std::istream required by readers.
+/// Final, so that calls from readers are not virtual.
 template <typename Character = char>
-class istream
+class istream final
 {
 public:
     DEFAULT_COPY_MOVE_DESTRUCT(istream);
@@ -74,7 +74,13 @@ namespace read
         using istream = byte_reader<std::istream>;
 
         /// A fast byte reader that reads from a system::istream.
-        using fast = byte_reader<system::istream<>>;
+        /// Final, so that calls through a fast reference are not virtual.
+        class fast final
+          : public byte_reader<system::istream<>>
+        {
+        public:
+            using byte_reader<system::istream<>>::byte_reader;
+        };
 
         /// A byte reader that copies from a data_reference via std::istream.
         using copy = make_streamer<copy_source<data_reference>, byte_reader>;
@@ -40,6 +40,10 @@ public:
     /// Constructors.
     sha256x2_writer(OStream& sink) NOEXCEPT;
 
+    /// Resume from the state of a count of whole blocks (a midstate).
+    sha256x2_writer(OStream& sink, const sha256::state_t& state,
+        size_t blocks) NOEXCEPT;
+
     /// Flush on destruct.
     ~sha256x2_writer() NOEXCEPT override;
 
@@ -101,6 +101,11 @@ public:
     hd_key to_hd_key() const NOEXCEPT;
     hd_public derive_public(uint32_t index) const NOEXCEPT;
 
+    /// Child points of [first, first + count), empty if any is hardened or
+    /// invalid. The parent point and chain code key are prepared only once.
+    compressed_list derive_public_range(uint32_t first,
+        size_t count) const NOEXCEPT;
+
 protected:
     /// Factories.
     static hd_public from_secret(const ec_secret& secret,
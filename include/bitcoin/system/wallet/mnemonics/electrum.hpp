@@ -29,6 +29,7 @@
 #include <bitcoin/system/wallet/keys/hd_private.hpp>
 #include <bitcoin/system/wallet/mnemonics/electrum_v1.hpp>
 #include <bitcoin/system/wallet/mnemonics/mnemonic.hpp>
+#include <bitcoin/system/wallet/mnemonics/recovery.hpp>
 #include <bitcoin/system/words/words.hpp>
 
 namespace libbitcoin {
@@ -98,6 +99,20 @@ public:
     static seed_prefix to_prefix(const string_list& words) NOEXCEPT;
     static seed_prefix to_prefix(const std::string& sentence) NOEXCEPT;
 
+    /// Recover a partially known "recovery seed" by brute force search.
+    /// Unknown words are empty strings (up to recovery::maximum_unknowns).
+    /// Known words must be contained by the specified dictionary.
+    /// Candidates are seed version (prefix) verified before seed derivation
+    /// (PBKDF2), passing only 1/256 to 1/4096 of them (prefix dependent).
+    /// Candidates are distributed across the specified number of threads.
+    /// Prefix must be standard, witness or a two factor authentication type.
+    /// Returns the matching electrum, or invalid if not found or cancelled.
+    static electrum search(const string_list& words, seed_prefix prefix,
+        const recovery::matcher& match, const recovery::progress& report={},
+        size_t threads=1, const std::string& passphrase="",
+        language identifier=language::en,
+        const context& context=btc_mainnet_p2kh) NOEXCEPT;
+
     /// Convert a raw for "root seed" to its hd form.
     /// The "root seed" is also referred to by electrum as the "master key".
     /// There is no way to determine if this is a valid "root seed".
@@ -213,6 +228,9 @@ protected:
         seed_prefix prefix) NOEXCEPT;
     static long_hash seeder(const string_list& words,
         const std::string& passphrase) NOEXCEPT;
+    static std::vector<long_hash> seeder(
+        const std::vector<string_list>& phrases,
+        const data_slice& salt) NOEXCEPT;
 
     static electrum from_words(const string_list& words,
         language identifier) NOEXCEPT;
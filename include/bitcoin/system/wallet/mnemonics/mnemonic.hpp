@@ -20,12 +20,14 @@
 #define LIBBITCOIN_SYSTEM_WALLET_MNEMONICS_MNEMONIC_HPP
 
 #include <string>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/radix/radix.hpp>
 #include <bitcoin/system/wallet/context.hpp>
 #include <bitcoin/system/wallet/keys/hd_private.hpp>
+#include <bitcoin/system/wallet/mnemonics/recovery.hpp>
 #include <bitcoin/system/words/words.hpp>
 
 namespace libbitcoin {
@@ -70,6 +72,19 @@ public:
     /// Valid word counts (12, 15, 18, 21, or 24 words).
     static bool is_valid_word_count(size_t count) NOEXCEPT;
 
+    /// Recover a partially known "recovery seed" by brute force search.
+    /// Unknown words are empty strings (up to recovery::maximum_unknowns).
+    /// Known words must be contained by the specified dictionary.
+    /// Candidates are checksum verified before seed derivation (PBKDF2),
+    /// passing only 1/16 to 1/256 of them, and are then seeded in lanes.
+    /// Candidates are distributed across the specified number of threads.
+    /// Returns the matching mnemonic, or invalid if not found or cancelled.
+    static mnemonic search(const string_list& words,
+        const recovery::matcher& match, const recovery::progress& report={},
+        size_t threads=1, const std::string& passphrase="",
+        language identifier=language::en,
+        const context& context=btc_mainnet_p2kh) NOEXCEPT;
+
     mnemonic() NOEXCEPT;
 
     /// wiki.trezor.io/recovery_seed
@@ -87,6 +102,12 @@ public:
     /// Returns null result with non-ascii passphrase and HAVE_ICU undefind.
     long_hash to_seed(const std::string& passphrase="") const NOEXCEPT;
 
+    /// Derive the "master binary seed" for each of a set of passphrases.
+    /// Seed derivations are computed concurrently across vector lanes.
+    /// Returns null results with non-ascii passphrases and HAVE_ICU undefind.
+    std::vector<long_hash> to_seeds(
+        const string_list& passphrases) const NOEXCEPT;
+
     /// wiki.trezor.io/account_private_key
     /// Derive the "account private key" from the "master binary seed".
     /// This is also known as the wallet "root key" or "master private key".
@@ -131,6 +152,11 @@ protected:
         language identifier) NOEXCEPT;
     static long_hash seeder(const string_list& words,
         const std::string& passphrase) NOEXCEPT;
+    static std::vector<long_hash> seeder(const string_list& words,
+        const string_list& passphrases) NOEXCEPT;
+    static std::vector<long_hash> seeder(
+        const std::vector<string_list>& phrases,
+        const data_slice& salt) NOEXCEPT;
 
     static mnemonic from_words(const string_list& words,
         language identifier) NOEXCEPT;
@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WALLET_MNEMONICS_RECOVERY_HPP
+#define LIBBITCOIN_SYSTEM_WALLET_MNEMONICS_RECOVERY_HPP
+
+#include <functional>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/wallet/addresses/payment_address.hpp>
+#include <bitcoin/system/wallet/keys/hd_private.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+/// Handlers for mnemonic and electrum brute force search (phrase recovery).
+/// Unknown words of a partial phrase are enumerated over the dictionary, and
+/// each candidate that survives its cheap filter (checksum or seed version)
+/// is seeded and tested against the matcher. Handlers must be thread safe.
+class BC_API recovery
+{
+public:
+    /// Return true if the candidate master private key is the target.
+    typedef std::function<bool(const hd_private& key)> matcher;
+
+    /// Invoked serially after each batch of candidates, with the number of
+    /// candidates enumerated and the total number of candidates.
+    /// Return false to cancel the search.
+    typedef std::function<bool(uint64_t tried, uint64_t total)> progress;
+
+    /// Up to five words may be unknown (2048^5 = 2^55 candidates).
+    static constexpr size_t maximum_unknowns = 5;
+
+    /// Match the fingerprint of the master public key (BIP32 key identifier).
+    static matcher match_fingerprint(uint32_t fingerprint) NOEXCEPT;
+
+    /// Match a compressed p2kh address derived from the master private key
+    /// via the given path (use hd_first_hardened_key for hardened indexes).
+    static matcher match_address(const payment_address& address,
+        const std_vector<uint32_t>& path={}) NOEXCEPT;
+};
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
+
+#endif
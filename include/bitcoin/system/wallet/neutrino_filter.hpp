@@ -27,6 +27,7 @@
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/chain/chain.hpp>
+#include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/wallet/addresses/payment_address.hpp>
 
 namespace libbitcoin {
@@ -39,6 +40,13 @@ struct BC_API block_filter
     data_chunk filter;
 };
 
+/// A block filter with decoded golomb-coded set, for repeated matching.
+struct BC_API decoded_filter
+{
+    siphash_key key;
+    golomb::decoded_set set;
+};
+
 bool BC_API compute_filter(data_chunk& out,
     const chain::block& block) NOEXCEPT;
 
@@ -57,6 +65,22 @@ bool BC_API match_filter(const block_filter& filter,
 bool BC_API match_filter(const block_filter& filter,
     const wallet::payment_address::list& addresses) NOEXCEPT;
 
+/// Decode the filter set once for matching against many targets.
+bool BC_API decode_filter(decoded_filter& out,
+    const block_filter& filter) NOEXCEPT;
+
+bool BC_API match_filter(const decoded_filter& filter,
+    const chain::script& script) NOEXCEPT;
+
+bool BC_API match_filter(const decoded_filter& filter,
+    const chain::scripts& scripts) NOEXCEPT;
+
+bool BC_API match_filter(const decoded_filter& filter,
+    const wallet::payment_address& address) NOEXCEPT;
+
+bool BC_API match_filter(const decoded_filter& filter,
+    const wallet::payment_address::list& addresses) NOEXCEPT;
+
 } // namespace neutrino
 } // namespace system
 } // namespace libbitcoin
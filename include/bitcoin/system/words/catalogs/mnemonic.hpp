@@ -30,7 +30,7 @@ namespace mnemonic {
 
 typedef words::dictionary<2048> catalog;
 
-// TODO: these are static initializations.
+// These are constant initializations, including each perfect hash.
 
 extern const catalog::words en;
 extern const catalog::words es;
@@ -21,6 +21,7 @@
 
 #include <array>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -31,21 +32,46 @@ namespace libbitcoin {
 namespace system {
 namespace words {
 
-// Search container for a dictionary of lexically-sorted words.
-// POD dictionary wrapper with O(n) search and O(1) index.
-// Search order is guaranteed, always returns first match.
+// Search container for a dictionary of unique words.
+// POD dictionary wrapper with O(1) search and O(1) index.
+// Search is by minimal perfect hash, generated with the word list at compile
+// time, so each lookup hashes the word once and compares at most one word.
 template<size_t Size>
 class dictionary final
 {
 public:
+    /// Perfect hash buckets, averaging two words each.
+    static constexpr size_t buckets = add1(to_half(Size));
+
     typedef std::vector<size_t> search;
     typedef std::vector<int32_t> result;
-    typedef struct { bool sorted; std_array<const char*, Size> word; } words;
-    static_assert(Size <= possible_narrow_sign_cast<size_t>(max_int32));
+    typedef std_array<const char*, Size> list;
+    static_assert(Size <= max_uint16);
+
+    /// Word list with its perfect hash, constructible only by hash().
+    class words
+    {
+    public:
+        bool sorted;
+        list word;
+        std_array<uint16_t, buckets> seed;
+        std_array<uint16_t, Size> slot;
+
+    private:
+        friend class dictionary;
+        constexpr words(bool is_sorted, const list& word_list) NOEXCEPT
+          : sorted(is_sorted), word(word_list), seed{}, slot{}
+        {
+        }
+    };
 
     /// The number of words in the dictionary.
     static constexpr size_t size() NOEXCEPT { return Size; };
 
+    /// Construct a word list with its perfect hash (compile time only).
+    /// Words must be unique. Sorted indicates lexical (char) sort order.
+    static CONSTEVAL words hash(bool sorted, const list& word) NOEXCEPT;
+
     /// Constructor.
     dictionary(language identifier, const words& words) NOEXCEPT;
 
@@ -64,23 +90,27 @@ public:
     string_list at(const search& indexes) const NOEXCEPT;
 
     /// -1 if word is not found.
-    int32_t index(const std::string& word) const NOEXCEPT;
+    int32_t index(std::string_view word) const NOEXCEPT;
 
     /// -1 for any word that is not found.
     result index(const string_list& words) const NOEXCEPT;
 
     /// True if the word is in the dictionary.
-    bool contains(const std::string& word) const NOEXCEPT;
+    bool contains(std::string_view word) const NOEXCEPT;
 
     /// True if all words are in the dictionary.
     bool contains(const string_list& words) const NOEXCEPT;
 
 private:
+    static constexpr uint64_t mix(uint64_t key) NOEXCEPT;
+    static constexpr uint64_t fingerprint(std::string_view word) NOEXCEPT;
+    static constexpr size_t position(uint64_t key, size_t seed) NOEXCEPT;
+
     // This dictionary creates only this one word of state.
     const language identifier_;
 
     // Arrays of words are declared statically and held by reference here.
-    // The array type is POD, so no words are copied into the array. Only
+    // The array type is trivially copyable, so no words are copied. Only
     // this wrapper dictionary object is created for each word list, for
     // each dictionaries object constructed by various mnemonic classes.
     const words& words_;
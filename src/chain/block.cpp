@@ -19,10 +19,12 @@
 #include <bitcoin/system/chain/block.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <memory>
 #include <numeric>
 #include <set>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -32,6 +34,7 @@
 #include <bitcoin/system/chain/enums/opcode.hpp>
 #include <bitcoin/system/chain/point.hpp>
 #include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
@@ -110,6 +113,25 @@ block::block(reader& source, bool witness) NOEXCEPT
     assign_data(source, witness);
 }
 
+block::block(read::bytes::fast&& source, bool witness) NOEXCEPT
+  : block(source, witness)
+{
+}
+
+block::block(read::bytes::fast& source, bool witness) NOEXCEPT
+  : header_(CREATE(chain::header, source.get_allocator(), source)),
+    txs_(CREATE(transaction_cptrs, source.get_allocator()))
+{
+    assign_data(source, witness);
+}
+
+block::block(reader& source, bool witness, script_pool& pool) NOEXCEPT
+  : header_(CREATE(chain::header, source.get_allocator(), source)),
+    txs_(CREATE(transaction_cptrs, source.get_allocator()))
+{
+    assign_data(source, witness, &pool);
+}
+
 // protected
 block::block(const chain::header::cptr& header,
     const transactions_cptr& txs, bool valid) NOEXCEPT
@@ -138,15 +160,27 @@ bool block::operator!=(const block& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // private
-void block::assign_data(reader& source, bool witness) NOEXCEPT
+template <typename Source>
+void block::assign_data(Source& source, bool witness,
+    script_pool* pool) NOEXCEPT
 {
-    auto& allocator = source.get_allocator();
+    byte_allocator& allocator = source.get_allocator();
     const auto count = source.read_size(max_block_size);
     auto txs = to_non_const_raw_ptr(txs_);
     txs->reserve(count);
 
-    for (size_t tx = 0; tx < count; ++tx)
-        txs->emplace_back(CREATE(transaction, allocator, source, witness));
+    if (is_null(pool))
+    {
+        for (size_t tx = 0; tx < count; ++tx)
+            txs->emplace_back(CREATE(transaction, allocator, source, witness));
+    }
+    else
+    {
+        reader& from = source;
+        for (size_t tx = 0; tx < count; ++tx)
+            txs->emplace_back(CREATE(transaction, allocator, from, witness,
+                *pool));
+    }
 
     size_ = serialized_size(*txs_);
     valid_ = source;
@@ -263,7 +297,7 @@ const hash_digest& block::get_hash() const NOEXCEPT
     return header_->get_hash();
 }
 
-void block::set_hashes(const data_chunk& data) NOEXCEPT
+void block::set_hashes(const data_slice& data) NOEXCEPT
 {
     constexpr auto header_size = chain::header::serialized_size();
 
@@ -274,30 +308,62 @@ void block::set_hashes(const data_chunk& data) NOEXCEPT
     auto start = std::next(data.data(), header_size);
     std::advance(start, size_variable(*start));
 
-    // Cache transaction hashes.
+    // Nominal serializations of segregated txs are copied contiguously.
+    const auto nominal = [](size_t total, const auto& tx) NOEXCEPT
+    {
+        return tx->is_segregated() ?
+            ceilinged_add(total, tx->serialized_size(false)) : total;
+    };
+
+    data_chunk nominals(std::accumulate(txs_->begin(), txs_->end(), zero,
+        nominal));
+
+    // Collect transaction hash preimages, in transaction order.
+    sha256::messages_t messages{};
+    messages.reserve(two * txs_->size());
+    auto to = nominals.data();
     auto coinbase = true;
+
     for (const auto& tx: *txs_)
     {
         const auto witness_size = tx->serialized_size(true);
+        const auto end = std::next(start, witness_size);
 
         // If !witness then wire txs cannot have been segregated.
         if (tx->is_segregated())
         {
             const auto nominal_size = tx->serialized_size(false);
-
-            tx->set_nominal_hash(transaction::desegregated_hash(
-                witness_size, nominal_size, start));
+            transaction::desegregate(to, witness_size, nominal_size, start);
+            messages.emplace_back(to, std::next(to, nominal_size));
+            std::advance(to, nominal_size);
 
             if (!coinbase)
-                tx->set_witness_hash(bitcoin_hash(witness_size, start));
+                messages.emplace_back(start, end);
         }
         else
         {
-            tx->set_nominal_hash(bitcoin_hash(witness_size, start));
+            messages.emplace_back(start, end);
         }
 
         coinbase = false;
-        std::advance(start, witness_size);
+        start = end;
+    }
+
+    // Hash all preimages across vector lanes (as available).
+    const auto digests = sha256::double_hashes(messages);
+
+    // Cache transaction hashes, in same order as collected.
+    auto digest = digests.begin();
+    coinbase = true;
+
+    for (const auto& tx: *txs_)
+    {
+        tx->set_nominal_hash(*digest++);
+
+        if (tx->is_segregated() && !coinbase)
+            tx->set_witness_hash(*digest++);
+
+        coinbase = false;
     }
 }
 
@@ -756,6 +822,67 @@ code block::connect_transactions(const context& ctx) const NOEXCEPT
     return error::block_success;
 }
 
+// Do NOT invoke on coinbase.
+// Inputs are claimed in block order and the lowest failing index prevails, so
+// the result is deterministic and matches the sequential connect_transactions.
+code block::connect_transactions(const context& ctx,
+    size_t threads) const NOEXCEPT
+{
+    using input_iterator = transaction::input_iterator;
+    typedef struct { const transaction& tx; input_iterator input; } job;
+
+    if (threads < two || is_empty())
+        return connect_transactions(ctx);
+
+    std_vector<job> jobs{};
+    for (auto tx = std::next(txs_->begin()); tx != txs_->end(); ++tx)
+    {
+        // Sighash cache is not thread safe, so initialize in advance.
+        const auto& inputs = *(*tx)->inputs_ptr();
+        (*tx)->initialize_sighash_cache();
+
+        for (auto in = inputs.begin(); in != inputs.end(); ++in)
+            jobs.push_back({ **tx, in });
+    }
+
+    // A coinbase-only block has no inputs to connect.
+    if (jobs.empty())
+        return error::block_success;
+
+    const auto count = jobs.size();
+    const auto width = std::min(threads, count);
+    std_vector<code> codes(count);
+    std::atomic<size_t> next{ zero };
+    std::atomic<size_t> first{ count };
+
+    const auto work = [&]() NOEXCEPT
+    {
+        // Inputs following a known failure cannot change the outcome.
+        for (auto index = next++; index < first.load(); index = next++)
+        {
+            const auto& item = jobs.at(index);
+            if (const auto ec = item.tx.connect_input(ctx, item.input))
+            {
+                codes.at(index) = ec;
+                auto prior = first.load();
+                while (index < prior &&
+                    !first.compare_exchange_weak(prior, index));
+            }
+        }
+    };
+
+    std_vector<std::thread> workers{};
+    workers.reserve(sub1(width));
+    for (auto thread = one; thread < width; ++thread)
+        workers.emplace_back(work);
+
+    work();
+    for (auto& worker: workers)
+        worker.join();
+
+    return first < count ? codes.at(first) : error::block_success;
+}
+
 // Do NOT invoke on coinbase.
 code block::confirm_transactions(const context& ctx) const NOEXCEPT
 {
@@ -886,6 +1013,27 @@ code block::connect(const context& ctx) const NOEXCEPT
     return connect_transactions(ctx);
 }
 
+code block::connect(const context& ctx, size_t threads) const NOEXCEPT
+{
+    return connect_transactions(ctx, threads);
+}
+
+code block::connect_batched(const context& ctx) const NOEXCEPT
+{
+    if (is_empty())
+        return error::block_success;
+
+    signature_batch batch{};
+    for (auto tx = std::next(txs_->begin()); tx != txs_->end(); ++tx)
+        if ((*tx)->connect(ctx, batch))
+            return connect_transactions(ctx);
+
+    if (verify_signatures(batch) != batch.size())
+        return connect_transactions(ctx);
+
+    return error::block_success;
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 
@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/block_view.hpp>
+
+#include <iterator>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/transaction_view.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+block_view::block_view() NOEXCEPT
+  : data_{},
+    txs_{},
+    count_{},
+    nominal_{},
+    segregated_(false),
+    valid_(false)
+{
+}
+
+// Each transaction is viewed once to establish block extent and validity.
+block_view::block_view(const data_slice& data) NOEXCEPT
+  : block_view()
+{
+    constexpr auto header_size = chain::header::serialized_size();
+
+    stream::in::fast stream{ data };
+    read::bytes::fast source{ stream };
+    source.skip_bytes(header_size);
+    const auto count = source.read_size(max_block_size);
+    if (!source)
+        return;
+
+    const auto start = source.get_read_position();
+    auto nominal = start;
+    auto end = start;
+    auto segregated = false;
+
+    for (size_t tx = 0; tx < count; ++tx)
+    {
+        const transaction_view view{ { std::next(data.begin(), end),
+            data.end() } };
+
+        if (!view.is_valid())
+            return;
+
+        end = ceilinged_add(end, view.serialized_size(true));
+        nominal = ceilinged_add(nominal, view.serialized_size(false));
+        segregated |= view.is_segregated();
+    }
+
+    data_ = { data.begin(), std::next(data.begin(), end) };
+    txs_ = { std::next(data.begin(), start), std::next(data.begin(), end) };
+    count_ = count;
+    nominal_ = nominal;
+    segregated_ = segregated;
+    valid_ = true;
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+bool block_view::is_valid() const NOEXCEPT
+{
+    return valid_;
+}
+
+bool block_view::is_segregated() const NOEXCEPT
+{
+    return segregated_;
+}
+
+size_t block_view::serialized_size(bool witness) const NOEXCEPT
+{
+    return witness ? data_.size() : nominal_;
+}
+
+hash_digest block_view::hash() const NOEXCEPT
+{
+    if (!valid_)
+        return null_hash;
+
+    return bitcoin_hash(chain::header::serialized_size(), data_.data());
+}
+
+chain::header block_view::header() const NOEXCEPT
+{
+    if (!valid_)
+        return {};
+
+    return chain::header{ data_slice{ data_.begin(),
+        std::next(data_.begin(), chain::header::serialized_size()) } };
+}
+
+transaction_views block_view::transactions() const NOEXCEPT
+{
+    return { txs_, count_ };
+}
+
+data_slice block_view::data() const NOEXCEPT
+{
+    return data_;
+}
+
+// Hashes can only be cached from the viewed buffer if it is the witness
+// serialization of the materialized block (or there is no witness).
+chain::block block_view::to_block(bool witness) const NOEXCEPT
+{
+    stream::in::fast stream{ data_ };
+    chain::block out{ stream, witness };
+    if (out.is_valid() && (witness || !segregated_))
+        out.set_hashes(data_);
+
+    return out;
+}
+
+BC_POP_WARNING()
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
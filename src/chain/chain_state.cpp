@@ -330,7 +330,8 @@ uint32_t chain_state::median_time_past(const data& values,
     const forks&) NOEXCEPT
 {
     // Sort the times by value to obtain the median.
-    auto times = sort_copy(values.timestamp.ordered);
+    const auto& ordered = values.timestamp.ordered;
+    auto times = sort(std::vector<uint32_t>{ ordered.begin(), ordered.end() });
 
     // Consensus defines median time using modulo 2 element selection.
     // This differs from arithmetic median which averages two middle values.
@@ -350,7 +351,7 @@ uint32_t chain_state::work_required(const data& values, const forks& forks,
         return 0;
 
     // Previous block has an invalid bits value.
-    if (is_zero(compact::expand(bits_high(values))))
+    if (!compact::expand_fixed(bits_high(values)))
         return 0;
 
     // Regtest bypasses all retargeting.
@@ -394,8 +395,14 @@ uint32_t chain_state::retarget_timespan(const data& values,
     return limit(timespan, minimum_timespan, maximum_timespan);
 }
 
-constexpr bool patch_timewarp(const forks& forks, const uint256_t& limit,
-    const uint256_t& target) NOEXCEPT
+// Equivalent to floored_log2(uint256_t).
+constexpr size_t floored_log2(const uint256& value) NOEXCEPT
+{
+    return is_zero(value.width()) ? zero : sub1(value.width());
+}
+
+constexpr bool patch_timewarp(const forks& forks, const uint256& limit,
+    const uint256& target) NOEXCEPT
 {
     return forks.retarget_overflow_patch &&
         floored_log2(target) >= floored_log2(limit);
@@ -406,11 +413,11 @@ uint32_t chain_state::work_required_retarget(const data& values,
     uint32_t minimum_timespan, uint32_t maximum_timespan,
     uint32_t retargeting_interval_seconds) NOEXCEPT
 {
-    static const auto limit = compact::expand(proof_of_work_limit);
-    auto target = compact::expand(bits_high(values));
+    static const auto limit = compact::expand_fixed(proof_of_work_limit);
+    auto target = compact::expand_fixed(bits_high(values));
 
     // Conditionally implement retarget overflow patch (e.g. Litecoin).
-    const auto timewarp = to_int(patch_timewarp(forks, limit, target));
+    const auto timewarp = to_int<size_t>(patch_timewarp(forks, limit, target));
 
     target >>= timewarp;
     target *= retarget_timespan(values, minimum_timespan, maximum_timespan);
@@ -419,7 +426,8 @@ uint32_t chain_state::work_required_retarget(const data& values,
 
     // Disallow target from falling below minimum configured.
     // All targets are a bits value normalized by compress here.
-    return target > limit ? proof_of_work_limit : compact::compress(target);
+    return target > limit ? proof_of_work_limit :
+        compact::compress(target.to_uintx());
 }
 
 // A retarget height, or a block that does not have proof_of_work_limit bits.
@@ -574,6 +582,7 @@ chain_state::data chain_state::to_pool(const chain_state& top,
     const auto& forks = top.forks_;
 
     // Copy data from presumed previous-height block state.
+    // Histories are shared with top, so this does not copy their values.
     chain_state::data data{ top.data_ };
 
     // If this overflows height is zero and result is handled as invalid.
@@ -648,7 +657,7 @@ chain_state::data chain_state::to_block(const chain_state& pool,
     data.bits.self = header.bits();
     data.version.self = header.version();
     data.timestamp.self = header.timestamp();
-    data.cumulative_work += header.proof();
+    data.cumulative_work += header::proof_fixed(header.bits());
 
     // Cache hash of bip9 bit0 height block, otherwise use preceding state.
     if (data.height == settings.bip9_bit0_active_checkpoint.height())
@@ -687,7 +696,7 @@ chain_state::data chain_state::to_header(const chain_state& parent,
     data.bits.self = header.bits();
     data.version.self = header.version();
     data.timestamp.self = header.timestamp();
-    data.cumulative_work += header.proof();
+    data.cumulative_work += header::proof_fixed(header.bits());
 
     // Cache hash of bip9 bit0 height block, otherwise use preceding state.
     if (data.height == settings.bip9_bit0_active_checkpoint.height())
@@ -744,9 +753,9 @@ const hash_digest& chain_state::hash() const NOEXCEPT
     return data_.hash;
 }
 
-const uint256_t& chain_state::cumulative_work() const NOEXCEPT
+uint256_t chain_state::cumulative_work() const NOEXCEPT
 {
-    return data_.cumulative_work;
+    return data_.cumulative_work.to_uintx();
 }
 
 uint32_t chain_state::minimum_block_version() const NOEXCEPT
@@ -0,0 +1,571 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/compact_transaction.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/prevout.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// Buffer layout, for n inputs and m outputs (integers are little-endian):
+//
+// points     [n][36] wire serialized point (hash, index)
+// sequences  [n][4]
+// prevouts   [n][8]  prevout value (zero if not populated)
+// heights    [n][8]  prevout metadata height
+// times      [n][4]  prevout metadata median time past
+// populated  [n][1]  prevout is populated, metadata spent and coinbase bits
+// values     [m][8]  output value
+// spans      [3n+m+1][4] cumulative pool offsets, in order of:
+//            input scripts [n], witnesses [n], prevout scripts [n],
+//            output scripts [m]
+// pool       unprefixed scripts and prefixed witnesses (empty if none)
+
+constexpr auto point_size = point::serialized_size();
+constexpr auto sequence_size = sizeof(uint32_t);
+constexpr auto value_size = sizeof(uint64_t);
+constexpr auto offset_size = sizeof(uint32_t);
+constexpr auto height_size = sizeof(uint64_t);
+constexpr auto time_size = sizeof(uint32_t);
+constexpr auto input_spans = 3_size;
+
+// Bits of the populated byte.
+constexpr uint8_t populated_bit = 0x01;
+constexpr uint8_t spent_bit = 0x02;
+constexpr uint8_t coinbase_bit = 0x04;
+
+inline size_t witness_size(const chain::witness& witness) NOEXCEPT
+{
+    return witness.stack().empty() ? zero : witness.serialized_size(true);
+}
+
+inline size_t script_size(const output::cptr& prevout) NOEXCEPT
+{
+    return prevout ? prevout->script().serialized_size(false) : zero;
+}
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+compact_transaction::compact_transaction() NOEXCEPT
+  : data_{},
+    version_(0),
+    locktime_(0),
+    inputs_(0),
+    outputs_(0),
+    segregated_(false),
+    valid_(false)
+{
+}
+
+compact_transaction::compact_transaction(const transaction& tx) NOEXCEPT
+  : compact_transaction()
+{
+    const auto& ins = *tx.inputs_ptr();
+    const auto& outs = *tx.outputs_ptr();
+
+    if (!tx.is_valid() || ins.size() > max_uint32 || outs.size() > max_uint32)
+        return;
+
+    auto pool = zero;
+    for (const auto& in: ins)
+    {
+        pool = ceilinged_add(pool, in->script().serialized_size(false));
+        pool = ceilinged_add(pool, witness_size(in->witness()));
+        pool = ceilinged_add(pool, script_size(in->prevout));
+    }
+
+    for (const auto& out: outs)
+        pool = ceilinged_add(pool, out->script().serialized_size(false));
+
+    // Pool offsets are 32 bits.
+    if (pool > max_uint32)
+        return;
+
+    version_ = tx.version();
+    locktime_ = tx.locktime();
+    inputs_ = possible_narrow_cast<uint32_t>(ins.size());
+    outputs_ = possible_narrow_cast<uint32_t>(outs.size());
+    segregated_ = tx.is_segregated();
+
+    // The one allocation.
+    data_.resize(pool_offset() + pool);
+    const auto buffer = data_.data();
+    const auto offsets = std::next(buffer, spans_offset());
+    const auto start = std::next(buffer, pool_offset());
+    data_slab slab{ start, std::next(start, pool) };
+
+    stream::out::fast stream{ slab };
+    write::bytes::fast sink{ stream };
+    auto count = zero;
+
+    // Pool offsets follow the sink, which writes sections in span order.
+    const auto next = [&]() NOEXCEPT
+    {
+        unsafe_to_little_endian<uint32_t>(std::next(offsets,
+            ++count * offset_size), possible_narrow_cast<uint32_t>(
+                sink.get_write_position()));
+    };
+
+    unsafe_to_little_endian<uint32_t>(offsets, 0_u32);
+    for (size_t index = 0; index < ins.size(); ++index)
+    {
+        const auto& in = *ins[index];
+        const auto& point = in.point();
+        const auto to = std::next(buffer, index * point_size);
+        std::copy(point.hash().begin(), point.hash().end(), to);
+        unsafe_to_little_endian<uint32_t>(std::next(to, hash_size),
+            point.index());
+        unsafe_to_little_endian<uint32_t>(std::next(buffer,
+            sequences_offset() + index * sequence_size), in.sequence());
+
+        in.script().to_data(sink, false);
+        next();
+    }
+
+    for (const auto& in: ins)
+    {
+        if (!is_zero(witness_size(in->witness())))
+            in->witness().to_data(sink, true);
+
+        next();
+    }
+
+    for (size_t index = 0; index < ins.size(); ++index)
+    {
+        const auto& in = *ins[index];
+        const auto& prevout = in.prevout;
+        const auto& metadata = in.metadata;
+        auto& bits = buffer[populated_offset() + index];
+
+        unsafe_to_little_endian<uint64_t>(std::next(buffer,
+            heights_offset() + index * height_size),
+            possible_wide_cast<uint64_t>(metadata.height));
+        unsafe_to_little_endian<uint32_t>(std::next(buffer,
+            times_offset() + index * time_size), metadata.median_time_past);
+
+        if (metadata.spent) bits |= spent_bit;
+        if (metadata.coinbase) bits |= coinbase_bit;
+
+        if (prevout)
+        {
+            unsafe_to_little_endian<uint64_t>(std::next(buffer,
+                prevouts_offset() + index * value_size), prevout->value());
+            bits |= populated_bit;
+            prevout->script().to_data(sink, false);
+        }
+
+        next();
+    }
+
+    for (size_t index = 0; index < outs.size(); ++index)
+    {
+        const auto& out = *outs[index];
+        unsafe_to_little_endian<uint64_t>(std::next(buffer,
+            values_offset() + index * value_size), out.value());
+
+        out.script().to_data(sink, false);
+        next();
+    }
+
+    sink.flush();
+    valid_ = sink && count == spans();
+}
+
+// Operators.
+// ----------------------------------------------------------------------------
+
+bool compact_transaction::operator==(
+    const compact_transaction& other) const NOEXCEPT
+{
+    return (version_ == other.version_)
+        && (locktime_ == other.locktime_)
+        && (inputs_ == other.inputs_)
+        && (outputs_ == other.outputs_)
+        && (data_ == other.data_);
+}
+
+bool compact_transaction::operator!=(
+    const compact_transaction& other) const NOEXCEPT
+{
+    return !(*this == other);
+}
+
+// Serialization.
+// ----------------------------------------------------------------------------
+
+// Transactions with empty witnesses always use old serialization (bip144).
+data_chunk compact_transaction::to_data(bool witness) const NOEXCEPT
+{
+    data_chunk data(serialized_size(witness));
+    stream::out::copy ostream(data);
+    write::bytes::ostream out(ostream);
+    to_data(out, witness);
+    return data;
+}
+
+void compact_transaction::to_data(writer& sink, bool witness) const NOEXCEPT
+{
+    witness &= segregated_;
+
+    sink.write_4_bytes_little_endian(version_);
+
+    if (witness)
+    {
+        sink.write_byte(witness_marker);
+        sink.write_byte(witness_enabled);
+    }
+
+    sink.write_variable(inputs_);
+    for (size_t index = 0; index < inputs_; ++index)
+    {
+        const auto script = input_script(index);
+        sink.write_bytes(std::next(data_.data(), index * point_size),
+            point_size);
+        sink.write_variable(script.size());
+        sink.write_bytes(script);
+        sink.write_4_bytes_little_endian(sequence(index));
+    }
+
+    sink.write_variable(outputs_);
+    for (size_t index = 0; index < outputs_; ++index)
+    {
+        const auto script = output_script(index);
+        sink.write_8_bytes_little_endian(value(index));
+        sink.write_variable(script.size());
+        sink.write_bytes(script);
+    }
+
+    // An empty witness serializes as its zero element count.
+    if (witness)
+    {
+        for (size_t index = 0; index < inputs_; ++index)
+        {
+            const auto stack = compact_transaction::witness(index);
+            if (stack.empty())
+                sink.write_variable(zero);
+            else
+                sink.write_bytes(stack);
+        }
+    }
+
+    sink.write_4_bytes_little_endian(locktime_);
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+bool compact_transaction::is_valid() const NOEXCEPT
+{
+    return valid_;
+}
+
+bool compact_transaction::is_segregated() const NOEXCEPT
+{
+    return segregated_;
+}
+
+bool compact_transaction::is_coinbase() const NOEXCEPT
+{
+    return is_one(inputs_) && point(zero).is_null();
+}
+
+size_t compact_transaction::serialized_size(bool witness) const NOEXCEPT
+{
+    witness &= segregated_;
+
+    auto size = sizeof(version_) + sizeof(locktime_) +
+        variable_size(inputs_) + variable_size(outputs_);
+
+    for (size_t index = 0; index < inputs_; ++index)
+    {
+        const auto script = input_script(index).size();
+        size += point_size + variable_size(script) + script + sequence_size;
+    }
+
+    for (size_t index = 0; index < outputs_; ++index)
+    {
+        const auto script = output_script(index).size();
+        size += value_size + variable_size(script) + script;
+    }
+
+    if (witness)
+    {
+        size += sizeof(witness_marker) + sizeof(witness_enabled);
+        for (size_t index = 0; index < inputs_; ++index)
+            size += std::max(one, compact_transaction::witness(index).size());
+    }
+
+    return size;
+}
+
+size_t compact_transaction::allocation() const NOEXCEPT
+{
+    return data_.size();
+}
+
+uint32_t compact_transaction::version() const NOEXCEPT
+{
+    return version_;
+}
+
+uint32_t compact_transaction::locktime() const NOEXCEPT
+{
+    return locktime_;
+}
+
+size_t compact_transaction::inputs() const NOEXCEPT
+{
+    return inputs_;
+}
+
+size_t compact_transaction::outputs() const NOEXCEPT
+{
+    return outputs_;
+}
+
+// Input elements.
+// ----------------------------------------------------------------------------
+
+chain::point compact_transaction::point(size_t input) const NOEXCEPT
+{
+    return { unsafe_array_cast<uint8_t, hash_size>(std::next(data_.data(),
+        input * point_size)), point_index(input) };
+}
+
+data_slice compact_transaction::point_hash(size_t input) const NOEXCEPT
+{
+    const auto hash = std::next(data_.data(), input * point_size);
+    return { hash, std::next(hash, hash_size) };
+}
+
+uint32_t compact_transaction::point_index(size_t input) const NOEXCEPT
+{
+    return unsafe_from_little_endian<uint32_t>(std::next(data_.data(),
+        input * point_size + hash_size));
+}
+
+uint32_t compact_transaction::sequence(size_t input) const NOEXCEPT
+{
+    return unsafe_from_little_endian<uint32_t>(std::next(data_.data(),
+        sequences_offset() + input * sequence_size));
+}
+
+data_slice compact_transaction::input_script(size_t input) const NOEXCEPT
+{
+    return span(input);
+}
+
+data_slice compact_transaction::witness(size_t input) const NOEXCEPT
+{
+    return span(inputs_ + input);
+}
+
+bool compact_transaction::is_populated(size_t input) const NOEXCEPT
+{
+    return !is_zero(data_[populated_offset() + input] & populated_bit);
+}
+
+uint64_t compact_transaction::prevout_value(size_t input) const NOEXCEPT
+{
+    return unsafe_from_little_endian<uint64_t>(std::next(data_.data(),
+        prevouts_offset() + input * value_size));
+}
+
+data_slice compact_transaction::prevout_script(size_t input) const NOEXCEPT
+{
+    return span(two * inputs_ + input);
+}
+
+chain::prevout compact_transaction::metadata(size_t input) const NOEXCEPT
+{
+    const auto bits = data_[populated_offset() + input];
+    const auto height = unsafe_from_little_endian<uint64_t>(std::next(
+        data_.data(), heights_offset() + input * height_size));
+
+    return
+    {
+        possible_narrow_cast<size_t>(height),
+        unsafe_from_little_endian<uint32_t>(std::next(data_.data(),
+            times_offset() + input * time_size)),
+        !is_zero(bits & spent_bit),
+        !is_zero(bits & coinbase_bit)
+    };
+}
+
+// Output elements.
+// ----------------------------------------------------------------------------
+
+uint64_t compact_transaction::value(size_t output) const NOEXCEPT
+{
+    return unsafe_from_little_endian<uint64_t>(std::next(data_.data(),
+        values_offset() + output * value_size));
+}
+
+data_slice compact_transaction::output_script(size_t output) const NOEXCEPT
+{
+    return span(input_spans * inputs_ + output);
+}
+
+uint64_t compact_transaction::claim() const NOEXCEPT
+{
+    uint64_t total{};
+    for (size_t index = 0; index < outputs_; ++index)
+        total = ceilinged_add(total, value(index));
+
+    return total;
+}
+
+hash_digest compact_transaction::hash(bool witness) const NOEXCEPT
+{
+    // Witness coinbase tx hash is assumed to be null_hash (bip141).
+    if (witness && segregated_ && is_coinbase())
+        return null_hash;
+
+    BC_PUSH_WARNING(LOCAL_VARIABLE_NOT_INITIALIZED)
+    hash_digest digest;
+    BC_POP_WARNING()
+
+    stream::out::fast stream{ digest };
+    hash::sha256x2::fast sink{ stream };
+    to_data(sink, witness);
+    sink.flush();
+    return digest;
+}
+
+chain::transaction compact_transaction::to_transaction() const NOEXCEPT
+{
+    if (!valid_)
+        return {};
+
+    const auto ins = to_shared<input_cptrs>();
+    const auto outs = to_shared<output_cptrs>();
+    ins->reserve(inputs_);
+    outs->reserve(outputs_);
+
+    for (size_t index = 0; index < inputs_; ++index)
+    {
+        const auto stack = witness(index);
+        const auto in = to_shared<input>(
+            point(index),
+            chain::script{ input_script(index), false },
+            stack.empty() ? chain::witness{} : chain::witness{ stack, true },
+            sequence(index));
+
+        in->metadata = metadata(index);
+        if (is_populated(index))
+            in->prevout = to_shared<output>(prevout_value(index),
+                chain::script{ prevout_script(index), false });
+
+        ins->push_back(in);
+    }
+
+    for (size_t index = 0; index < outputs_; ++index)
+        outs->push_back(to_shared<output>(value(index),
+            chain::script{ output_script(index), false }));
+
+    return { version_, ins, outs, locktime_ };
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+size_t compact_transaction::spans() const NOEXCEPT
+{
+    return input_spans * inputs_ + outputs_;
+}
+
+size_t compact_transaction::sequences_offset() const NOEXCEPT
+{
+    return inputs_ * point_size;
+}
+
+size_t compact_transaction::prevouts_offset() const NOEXCEPT
+{
+    return sequences_offset() + inputs_ * sequence_size;
+}
+
+size_t compact_transaction::heights_offset() const NOEXCEPT
+{
+    return prevouts_offset() + inputs_ * value_size;
+}
+
+size_t compact_transaction::times_offset() const NOEXCEPT
+{
+    return heights_offset() + inputs_ * height_size;
+}
+
+size_t compact_transaction::populated_offset() const NOEXCEPT
+{
+    return times_offset() + inputs_ * time_size;
+}
+
+size_t compact_transaction::values_offset() const NOEXCEPT
+{
+    return populated_offset() + inputs_;
+}
+
+size_t compact_transaction::spans_offset() const NOEXCEPT
+{
+    return values_offset() + outputs_ * value_size;
+}
+
+size_t compact_transaction::pool_offset() const NOEXCEPT
+{
+    return spans_offset() + add1(spans()) * offset_size;
+}
+
+data_slice compact_transaction::span(size_t index) const NOEXCEPT
+{
+    const auto offsets = std::next(data_.data(), spans_offset());
+    const auto pool = std::next(data_.data(), pool_offset());
+    const auto begin = unsafe_from_little_endian<uint32_t>(std::next(offsets,
+        index * offset_size));
+    const auto end = unsafe_from_little_endian<uint32_t>(std::next(offsets,
+        add1(index) * offset_size));
+
+    return { std::next(pool, begin), std::next(pool, end) };
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
@@ -96,6 +96,16 @@ header::header(reader& source) NOEXCEPT
     assign_data(source);
 }
 
+header::header(read::bytes::fast&& source) NOEXCEPT
+  : header(source)
+{
+}
+
+header::header(read::bytes::fast& source) NOEXCEPT
+{
+    assign_data(source);
+}
+
 // protected
 header::header(uint32_t version, hash_digest&& previous_block_hash,
     hash_digest&& merkle_root, uint32_t timestamp, uint32_t bits,
@@ -146,7 +156,8 @@ bool header::operator!=(const header& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // private
-void header::assign_data(reader& source) NOEXCEPT
+template <typename Source>
+void header::assign_data(Source& source) NOEXCEPT
 {
     // Hashes are copied directly into to header-allocated space.
     // Integrals are stack-allocated and copied to header-allocated space.
@@ -261,14 +272,20 @@ const hash_digest& header::get_hash() const NOEXCEPT
 // static
 uint256_t header::proof(uint32_t bits) NOEXCEPT
 {
-    auto target = compact::expand(bits);
+    return proof_fixed(bits).to_uintx();
+}
+
+// static
+uint256 header::proof_fixed(uint32_t bits) NOEXCEPT
+{
+    const auto target = compact::expand_fixed(bits);
 
     //*************************************************************************
     // CONSENSUS: bits may be overflowed, which is guarded here.
     // A target of zero is disallowed so is useful as a sentinel value.
     //*************************************************************************
-    if (is_zero(target))
-        return target;
+    if (!target)
+        return {};
 
     //*************************************************************************
     // CONSENSUS: If target is (2^256)-1, division would fail, however compact
@@ -278,8 +295,9 @@ uint256_t header::proof(uint32_t bits) NOEXCEPT
     // We need to compute 2**256 / (target + 1), but we can't represent 2**256
     // as it's too large for uint256. However as 2**256 is at least as large as
     // target + 1, it is equal to ((2**256 - target - 1) / (target + 1)) + 1, or
-    // (~target / (target + 1)) + 1.
-    return ++(~target / (target + one));
+    // (~target / (target + 1)) + 1. This is computed over fixed-width limbs.
+    auto work = ~target / (target + one);
+    return ++work;
 }
 
 // computed
@@ -295,14 +313,14 @@ uint256_t header::proof() const NOEXCEPT
 bool header::is_invalid_proof_of_work(uint32_t proof_of_work_limit,
     bool scrypt) const NOEXCEPT
 {
-    static const auto limit = compact::expand(proof_of_work_limit);
-    const auto target = compact::expand(bits_);
+    static const auto limit = compact::expand_fixed(proof_of_work_limit);
+    const auto target = compact::expand_fixed(bits_);
 
     //*************************************************************************
     // CONSENSUS: bits_ may be overflowed, which is guarded here.
     // A target of zero is disallowed so is useful as a sentinel value.
     //*************************************************************************
-    if (is_zero(target))
+    if (!target)
         return true;
 
     // Ensure claimed work is at or above minimum (less is more).
@@ -310,7 +328,8 @@ bool header::is_invalid_proof_of_work(uint32_t proof_of_work_limit,
         return true;
 
     // Conditionally use scrypt proof of work (e.g. Litecoin).
-    return to_uintx(scrypt ? scrypt_hash(to_data()) : hash()) > target;
+    return uint256::from_little_endian(scrypt ? scrypt_hash(to_data()) :
+        hash()) > target;
 }
 
 // ****************************************************************************
@@ -0,0 +1,237 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/headers_view.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <vector>
+#include <bitcoin/system/chain/compact.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// Use system clock because we require accurate time of day.
+using wall_clock = std::chrono::system_clock;
+
+// Wire offsets of header fields.
+constexpr auto header_size = header::serialized_size();
+constexpr auto previous_offset = sizeof(uint32_t);
+constexpr auto timestamp_offset = previous_offset + two * hash_size;
+constexpr auto bits_offset = timestamp_offset + sizeof(uint32_t);
+
+// Slices of the first count headers of data.
+template <typename Slices>
+static Slices to_slices(const data_slice& data, size_t count) NOEXCEPT
+{
+    Slices out{};
+    out.reserve(count);
+
+    for (auto start = data.begin(); out.size() < count;
+        std::advance(start, header_size))
+        out.emplace_back(start, std::next(start, header_size));
+
+    return out;
+}
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+headers_view::headers_view() NOEXCEPT
+  : data_{}, valid_(true)
+{
+}
+
+headers_view::headers_view(const data_slice& data) NOEXCEPT
+  : data_(data), valid_(is_zero(data.size() % header_size))
+{
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+bool headers_view::is_valid() const NOEXCEPT
+{
+    return valid_;
+}
+
+size_t headers_view::size() const NOEXCEPT
+{
+    return valid_ ? data_.size() / header_size : zero;
+}
+
+bool headers_view::empty() const NOEXCEPT
+{
+    return is_zero(size());
+}
+
+chain::header headers_view::header(size_t position) const NOEXCEPT
+{
+    BC_ASSERT(position < size());
+    const auto start = std::next(data_.begin(), position * header_size);
+    return chain::header{ data_slice{ start, std::next(start, header_size) } };
+}
+
+system::hashes headers_view::hashes() const NOEXCEPT
+{
+    // Headers are of equal size, so all are hashed across vector lanes.
+    return sha256::double_hashes(to_slices<sha256::messages_t>(data_,
+        size()));
+}
+
+chain::headers headers_view::to_headers() const NOEXCEPT
+{
+    const auto digests = hashes();
+    chain::headers out{};
+    out.reserve(digests.size());
+
+    for (size_t position = 0; position < digests.size(); ++position)
+    {
+        out.push_back(header(position));
+        out.back().set_hash(digests.at(position));
+    }
+
+    return out;
+}
+
+// Validation.
+// ----------------------------------------------------------------------------
+
+size_t headers_view::check(code& ec, const hash_digest& previous,
+    uint32_t timestamp_limit_seconds, uint32_t proof_of_work_limit,
+    bool scrypt) const NOEXCEPT
+{
+    if (!valid_)
+    {
+        ec = error::orphan_block;
+        return zero;
+    }
+
+    const auto limit = compact::expand_fixed(proof_of_work_limit);
+    const auto future = wall_clock::now() +
+        std::chrono::seconds(timestamp_limit_seconds);
+
+    // Targets change only on retarget, so are expanded once per bits value.
+    auto bits = proof_of_work_limit;
+    auto target = limit;
+    auto invalid_target = !limit;
+    const auto retarget = [&](const uint8_t* start) NOEXCEPT
+    {
+        const auto header_bits = unsafe_from_little_endian<uint32_t>(
+            std::next(start, bits_offset));
+
+        if (header_bits != bits)
+        {
+            //*****************************************************************
+            // CONSENSUS: bits may be overflowed, which is guarded here.
+            // A target of zero is disallowed so is useful as a sentinel value.
+            //*****************************************************************
+            target = compact::expand_fixed(header_bits);
+            invalid_target = !target || target > limit;
+            bits = header_bits;
+        }
+    };
+
+    const auto digests = hashes();
+    auto parent = &previous;
+    auto position = zero;
+    ec = error::block_success;
+
+    // Linkage, target and timestamp (and sha256 proof) are cheap to check.
+    for (; position < digests.size(); ++position)
+    {
+        const auto start = std::next(data_.data(), position * header_size);
+        const auto& digest = digests.at(position);
+
+        if (!std::equal(parent->begin(), parent->end(),
+            std::next(start, previous_offset)))
+        {
+            ec = error::orphan_block;
+            break;
+        }
+
+        retarget(start);
+
+        // Scrypt proof of work (e.g. Litecoin) is deferred to the prefix.
+        if (invalid_target || (!scrypt &&
+            uint256::from_little_endian(digest) > target))
+        {
+            ec = error::invalid_proof_of_work;
+            break;
+        }
+
+        const auto timestamp = unsafe_from_little_endian<uint32_t>(
+            std::next(start, timestamp_offset));
+
+        if (wall_clock::from_time_t(timestamp) > future)
+        {
+            ec = error::futuristic_timestamp;
+            break;
+        }
+
+        parent = &digest;
+    }
+
+    // A futuristic header is linked with a valid target, and its proof of
+    // work error takes precedence, so it is included in the scrypt prefix.
+    const auto linked = ec == error::futuristic_timestamp ? add1(position) :
+        position;
+
+    if (!scrypt || is_zero(linked))
+        return position;
+
+    // Scrypt proofs are independent, so all are romixed across vector lanes.
+    const auto proofs = scrypt_hashes(
+        to_slices<std::vector<data_slice>>(data_, linked));
+    const auto scrypted = proofs.size() == linked;
+
+    bits = proof_of_work_limit;
+    target = limit;
+
+    for (size_t index = 0; index < linked; ++index)
+    {
+        const auto start = std::next(data_.data(), index * header_size);
+        retarget(start);
+
+        if (uint256::from_little_endian(scrypted ? proofs.at(index) :
+            scrypt_hash({ start, std::next(start, header_size) })) > target)
+        {
+            ec = error::invalid_proof_of_work;
+            return index;
+        }
+    }
+
+    return position;
+}
+
+BC_POP_WARNING()
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/history.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// Small windows (e.g. timestamps) are reallocated at this minimum.
+constexpr size_t minimum_capacity = 16;
+
+history::buffer::buffer(size_t capacity, size_t size) NOEXCEPT
+  : values(capacity), size(size)
+{
+}
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+history::history() NOEXCEPT
+  : buffer_{}, begin_{}, end_{}
+{
+}
+
+// Modifiers.
+// ----------------------------------------------------------------------------
+
+void history::push_back(uint32_t value) NOEXCEPT
+{
+    if (!claim())
+        reallocate();
+
+    *std::next(buffer_->values.begin(), end_++) = value;
+}
+
+void history::pop_front() NOEXCEPT
+{
+    BC_ASSERT(!empty());
+    ++begin_;
+}
+
+// private
+// Claim the next slot if this is the newest window over the buffer.
+bool history::claim() NOEXCEPT
+{
+    if (!buffer_ || end_ == buffer_->values.size())
+        return false;
+
+    auto expected = end_;
+    return buffer_->size.compare_exchange_strong(expected, add1(end_));
+}
+
+// private
+// Copy the window to an exclusive buffer, with the next slot claimed.
+void history::reallocate() NOEXCEPT
+{
+    const auto count = size();
+    const auto capacity = std::max(minimum_capacity, shift_left(add1(count)));
+    const auto next = std::make_shared<buffer>(capacity, add1(count));
+    std::copy(begin(), end(), next->values.begin());
+
+    buffer_ = next;
+    begin_ = zero;
+    end_ = count;
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+bool history::empty() const NOEXCEPT
+{
+    return begin_ == end_;
+}
+
+size_t history::size() const NOEXCEPT
+{
+    return end_ - begin_;
+}
+
+uint32_t history::front() const NOEXCEPT
+{
+    BC_ASSERT(!empty());
+    return *begin();
+}
+
+uint32_t history::back() const NOEXCEPT
+{
+    BC_ASSERT(!empty());
+    return *std::prev(end());
+}
+
+// Iteration.
+// ----------------------------------------------------------------------------
+
+history::const_iterator history::begin() const NOEXCEPT
+{
+    return buffer_ ? std::next(buffer_->values.data(), begin_) : nullptr;
+}
+
+history::const_iterator history::end() const NOEXCEPT
+{
+    return buffer_ ? std::next(buffer_->values.data(), end_) : nullptr;
+}
+
+history::const_reverse_iterator history::rbegin() const NOEXCEPT
+{
+    return const_reverse_iterator{ end() };
+}
+
+history::const_reverse_iterator history::rend() const NOEXCEPT
+{
+    return const_reverse_iterator{ begin() };
+}
+
+history::const_reverse_iterator history::crbegin() const NOEXCEPT
+{
+    return rbegin();
+}
+
+history::const_reverse_iterator history::crend() const NOEXCEPT
+{
+    return rend();
+}
+
+// Operators.
+// ----------------------------------------------------------------------------
+
+bool history::operator==(const history& other) const NOEXCEPT
+{
+    return std::equal(begin(), end(), other.begin(), other.end());
+}
+
+bool history::operator!=(const history& other) const NOEXCEPT
+{
+    return !(*this == other);
+}
+
+BC_POP_WARNING()
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
@@ -185,6 +185,31 @@ input::input(reader& source) NOEXCEPT
 {
 }
 
+input::input(read::bytes::fast&& source) NOEXCEPT
+  : input(source)
+{
+}
+
+input::input(read::bytes::fast& source) NOEXCEPT
+  : point_(CREATE(chain::point, source.get_allocator(), source)),
+    script_(CREATE(chain::script, source.get_allocator(), source, true)),
+    witness_(CREATE(chain::witness, source.get_allocator())),
+    sequence_(source.read_4_bytes_little_endian()),
+    valid_(source),
+    size_(serialized_size(*script_))
+{
+}
+
+input::input(reader& source, script_pool& pool) NOEXCEPT
+  : point_(CREATE(chain::point, source.get_allocator(), source)),
+    script_(pool.intern_script(source)),
+    witness_(CREATE(chain::witness, source.get_allocator())),
+    sequence_(source.read_4_bytes_little_endian()),
+    valid_(source),
+    size_(serialized_size(*script_))
+{
+}
+
 // protected
 input::input(const chain::point::cptr& point, const chain::script::cptr& script,
     const chain::witness::cptr& witness, uint32_t sequence, bool valid) NOEXCEPT
@@ -306,6 +331,21 @@ void input::set_witness(reader& source) NOEXCEPT
         witness_->serialized_size(true));
 }
 
+void input::set_witness(read::bytes::fast& source) NOEXCEPT
+{
+    auto& allocator = source.get_allocator();
+    witness_.reset(CREATE(chain::witness, allocator, source, true));
+    size_.witnessed = ceilinged_add(size_.nominal,
+        witness_->serialized_size(true));
+}
+
+void input::set_witness(reader& source, script_pool& pool) NOEXCEPT
+{
+    witness_ = pool.intern_witness(source);
+    size_.witnessed = ceilinged_add(size_.nominal,
+        witness_->serialized_size(true));
+}
+
 // Properties.
 // ----------------------------------------------------------------------------
 
@@ -160,6 +160,16 @@ operation::operation(reader& source) NOEXCEPT
     assign_data(source);
 }
 
+operation::operation(read::bytes::fast&& source) NOEXCEPT
+  : operation(source)
+{
+}
+
+operation::operation(read::bytes::fast& source) NOEXCEPT
+{
+    assign_data(source);
+}
+
 operation::operation(const std::string& mnemonic) NOEXCEPT
   : operation(from_string(mnemonic))
 {
@@ -191,9 +201,10 @@ bool operation::operator!=(const operation& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // private
-void operation::assign_data(reader& source) NOEXCEPT
+template <typename Source>
+void operation::assign_data(Source& source) NOEXCEPT
 {
-    auto& allocator = source.get_allocator();
+    byte_allocator& allocator = source.get_allocator();
 
     // Guard against resetting a previously-invalid stream.
     if (!source)
@@ -530,41 +541,6 @@ size_t operation::serialized_size() const NOEXCEPT
     }
 }
 
-// Utilities.
-// ----------------------------------------------------------------------------
-
-// static/private
-// Advances stream, returns true unless exhausted.
-// Does not advance to end position in the case of underflow operation.
-bool operation::count_op(reader& source) NOEXCEPT
-{
-    if (source.is_exhausted())
-        return false;
-
-    const auto code = static_cast<opcode>(source.read_byte());
-    source.skip_bytes(read_data_size(code, source));
-    return true;
-}
-
-// static/private
-uint32_t operation::read_data_size(opcode code, reader& source) NOEXCEPT
-{
-    constexpr auto op_75 = static_cast<uint8_t>(opcode::push_size_75);
-
-    switch (code)
-    {
-        case opcode::push_one_size:
-            return source.read_byte();
-        case opcode::push_two_size:
-            return source.read_2_bytes_little_endian();
-        case opcode::push_four_size:
-            return source.read_4_bytes_little_endian();
-        default:
-            const auto byte = static_cast<uint8_t>(code);
-            return byte <= op_75 ? byte : 0;
-    }
-}
-
 // Categories of operations.
 // ----------------------------------------------------------------------------
 
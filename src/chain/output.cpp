@@ -98,6 +98,27 @@ output::output(reader& source) NOEXCEPT
 {
 }
 
+output::output(read::bytes::fast&& source) NOEXCEPT
+  : output(source)
+{
+}
+
+output::output(read::bytes::fast& source) NOEXCEPT
+  : value_(source.read_8_bytes_little_endian()),
+    script_(CREATE(chain::script, source.get_allocator(), source, true)),
+    valid_(source),
+    size_(serialized_size(*script_, value_))
+{
+}
+
+output::output(reader& source, script_pool& pool) NOEXCEPT
+  : value_(source.read_8_bytes_little_endian()),
+    script_(pool.intern_script(source)),
+    valid_(source),
+    size_(serialized_size(*script_, value_))
+{
+}
+
 // protected
 output::output(uint64_t value, const chain::script::cptr& script,
     bool valid) NOEXCEPT
@@ -88,6 +88,16 @@ point::point(reader& source) NOEXCEPT
     assign_data(source);
 }
 
+point::point(read::bytes::fast&& source) NOEXCEPT
+  : point(source)
+{
+}
+
+point::point(read::bytes::fast& source) NOEXCEPT
+{
+    assign_data(source);
+}
+
 // protected
 point::point(hash_digest&& hash, uint32_t index, bool valid) NOEXCEPT
   : hash_(std::move(hash)), index_(index), valid_(valid)
@@ -125,7 +135,8 @@ bool operator<(const point& left, const point& right) NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // private
-void point::assign_data(reader& source) NOEXCEPT
+template <typename Source>
+void point::assign_data(Source& source) NOEXCEPT
 {
     source.read_bytes(hash_.data(), hash_size);
     index_ = source.read_4_bytes_little_endian();
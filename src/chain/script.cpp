@@ -148,6 +148,17 @@ script::script(reader& source, bool prefix) NOEXCEPT
     assign_data(source, prefix);
 }
 
+script::script(read::bytes::fast&& source, bool prefix) NOEXCEPT
+  : script(source, prefix)
+{
+}
+
+script::script(read::bytes::fast& source, bool prefix) NOEXCEPT
+  : ops_(source.get_arena())
+{
+    assign_data(source, prefix);
+}
+
 script::script(const std::string& mnemonic) NOEXCEPT
   : script(from_string(mnemonic))
 {
@@ -222,7 +233,8 @@ bool script::operator!=(const script& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-size_t script::op_count(reader& source) NOEXCEPT
+template <typename Source>
+size_t script::op_count(Source& source) NOEXCEPT
 {
     // Stream errors reset by set_position so trap here.
     if (!source)
@@ -240,7 +252,8 @@ size_t script::op_count(reader& source) NOEXCEPT
 }
 
 // private
-void script::assign_data(reader& source, bool prefix) NOEXCEPT
+template <typename Source>
+void script::assign_data(Source& source, bool prefix) NOEXCEPT
 {
     size_t expected{};
     prefail_ = false;
@@ -423,6 +436,9 @@ script_version script::version() const NOEXCEPT
     {
         case opcode::push_size_0:
             return script_version::zero;
+        case opcode::push_positive_1:
+            return witness_program().size() == hash_size ?
+                script_version::one : script_version::reserved;
         default:
             return script_version::reserved;
     }
@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/script_cache.hpp>
+
+#include <mutex>
+#include <shared_mutex>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+script_cache::script_cache(size_t capacity) NOEXCEPT
+  : capacity_(capacity)
+{
+    set_.reserve(capacity);
+    order_.reserve(capacity);
+}
+
+bool script_cache::find(const hash_digest& hash, uint32_t index,
+    uint32_t flags) const NOEXCEPT
+{
+    bool found{};
+    {
+        std::shared_lock lock{ mutex_ };
+        found = set_.contains({ hash, index, flags });
+    }
+
+    if (found)
+        ++hits_;
+    else
+        ++misses_;
+
+    return found;
+}
+
+// Order is a ring of insertion, the next position holds the oldest entry.
+void script_cache::store(const hash_digest& hash, uint32_t index,
+    uint32_t flags) NOEXCEPT
+{
+    if (is_zero(capacity_))
+        return;
+
+    const key value{ hash, index, flags };
+    std::unique_lock lock{ mutex_ };
+
+    if (!set_.insert(value).second)
+        return;
+
+    if (order_.size() < capacity_)
+    {
+        order_.push_back(value);
+        return;
+    }
+
+    set_.erase(order_.at(next_));
+    order_.at(next_) = value;
+    next_ = (add1(next_) == capacity_) ? zero : add1(next_);
+}
+
+void script_cache::clear() NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    set_.clear();
+    order_.clear();
+    next_ = zero;
+}
+
+size_t script_cache::size() const NOEXCEPT
+{
+    std::shared_lock lock{ mutex_ };
+    return set_.size();
+}
+
+size_t script_cache::capacity() const NOEXCEPT
+{
+    return capacity_;
+}
+
+size_t script_cache::hits() const NOEXCEPT
+{
+    return hits_.load();
+}
+
+size_t script_cache::misses() const NOEXCEPT
+{
+    return misses_.load();
+}
+
+BC_POP_WARNING()
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
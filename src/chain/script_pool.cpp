@@ -0,0 +1,259 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/script_pool.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+#include <bitcoin/system/chain/operation.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// Approximate heap overhead of a shared pointer control block (counters and
+// deleter), and of an unordered map node beyond its value (next and hash).
+constexpr auto control_size = two * sizeof(size_t);
+constexpr auto node_size = two * sizeof(size_t);
+
+// Key bytes, map node (key and shared pointer) and instance control block.
+inline size_t entry_size(const data_chunk& key) NOEXCEPT
+{
+    return key.capacity() + node_size + sizeof(data_chunk) +
+        sizeof(std::shared_ptr<void>) + control_size;
+}
+
+// Shared chunk (control block, vector and its bytes).
+inline size_t chunk_size(const data_chunk& chunk) NOEXCEPT
+{
+    return control_size + sizeof(data_chunk) + chunk.capacity();
+}
+
+script_pool::script_pool(size_t capacity, size_t limit) NOEXCEPT
+  : capacity_(capacity), limit_(std::min(capacity, limit))
+{
+}
+
+// Interning.
+// ----------------------------------------------------------------------------
+
+script::cptr script_pool::intern_script(reader& source) NOEXCEPT
+{
+    const auto size = source.read_size();
+
+    // Not pooled, read as script(source, true) but for the consumed prefix.
+    if (size > limit_)
+    {
+        source.set_limit(size);
+        script::cptr out{ CREATE(script, source.get_allocator(), source,
+            false) };
+        source.set_limit();
+        if (out->serialized_size(false) != size)
+            source.invalidate();
+
+        return out;
+    }
+
+    auto key = source.read_bytes(size);
+    if (!source)
+        return to_shared<script>();
+
+    if (const auto pooled = find(scripts_, key))
+        return pooled;
+
+    // Pooled instances are parsed from key bytes onto the heap.
+    return store(scripts_, std::move(key), to_shared<script>(key, false),
+        false);
+}
+
+witness::cptr script_pool::intern_witness(reader& source) NOEXCEPT
+{
+    // Witness size is unknown until read, so it is skipped to measure.
+    const auto start = source.get_read_position();
+    witness::skip(source, true);
+    if (!source)
+        return to_shared<witness>();
+
+    const auto size = source.get_read_position() - start;
+    source.rewind_bytes(size);
+
+    // Not pooled, read as witness(source, true).
+    if (size > limit_)
+        return witness::cptr{ CREATE(witness, source.get_allocator(),
+            source, true) };
+
+    // Key is the serialization as read, parsed only if not pooled.
+    auto key = source.read_bytes(size);
+    if (const auto pooled = find(witnesses_, key))
+        return pooled;
+
+    return store(witnesses_, std::move(key), to_shared<witness>(key, true),
+        true);
+}
+
+// Footprint.
+// ----------------------------------------------------------------------------
+
+size_t script_pool::footprint(const data_chunk& key,
+    const script& instance) NOEXCEPT
+{
+    const auto& ops = instance.ops();
+    auto size = entry_size(key) + sizeof(script) +
+        ops.capacity() * sizeof(operation);
+
+    // Non-push operations share a static empty chunk.
+    for (const auto& op: ops)
+        if (!op.data().empty())
+            size += chunk_size(op.data());
+
+    return size;
+}
+
+size_t script_pool::footprint(const data_chunk& key,
+    const witness& instance) NOEXCEPT
+{
+    const auto& stack = instance.stack();
+    auto size = entry_size(key) + sizeof(witness) +
+        stack.capacity() * sizeof(chunk_cptr);
+
+    for (const auto& element: stack)
+        size += chunk_size(*element);
+
+    return size;
+}
+
+// private
+template <typename Map>
+typename Map::mapped_type script_pool::find(const Map& map,
+    const data_chunk& key) const NOEXCEPT
+{
+    typename Map::mapped_type out{};
+    {
+        std::shared_lock lock{ mutex_ };
+        const auto it = map.find(key);
+        if (it != map.end())
+            out = it->second;
+    }
+
+    if (out)
+        ++hits_;
+    else
+        ++misses_;
+
+    return out;
+}
+
+// private
+// Order is a queue of insertion, the front holds the oldest entry.
+template <typename Map>
+typename Map::mapped_type script_pool::store(Map& map, data_chunk&& key,
+    const typename Map::mapped_type& value, bool witness) NOEXCEPT
+{
+    if (is_zero(capacity_))
+        return value;
+
+    const auto size = footprint(key, *value);
+    std::unique_lock lock{ mutex_ };
+
+    // Another thread may have pooled the same key since find.
+    const auto result = map.emplace(std::move(key), value);
+    if (!result.second)
+        return result.first->second;
+
+    order_.push_back({ &result.first->first, size, witness });
+    bytes_ += size;
+    evict();
+    return value;
+}
+
+// private
+void script_pool::evict() NOEXCEPT
+{
+    while (bytes_ > capacity_ && !order_.empty())
+    {
+        const auto& oldest = order_.front();
+        bytes_ -= oldest.size;
+
+        if (oldest.witness)
+            witnesses_.erase(witnesses_.find(*oldest.key));
+        else
+            scripts_.erase(scripts_.find(*oldest.key));
+
+        order_.pop_front();
+    }
+}
+
+void script_pool::clear() NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    scripts_.clear();
+    witnesses_.clear();
+    order_.clear();
+    bytes_ = zero;
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+size_t script_pool::size() const NOEXCEPT
+{
+    std::shared_lock lock{ mutex_ };
+    return scripts_.size() + witnesses_.size();
+}
+
+size_t script_pool::bytes() const NOEXCEPT
+{
+    std::shared_lock lock{ mutex_ };
+    return bytes_;
+}
+
+size_t script_pool::capacity() const NOEXCEPT
+{
+    return capacity_;
+}
+
+size_t script_pool::limit() const NOEXCEPT
+{
+    return limit_;
+}
+
+size_t script_pool::hits() const NOEXCEPT
+{
+    return hits_.load();
+}
+
+size_t script_pool::misses() const NOEXCEPT
+{
+    return misses_.load();
+}
+
+BC_POP_WARNING()
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
@@ -68,6 +68,24 @@ static const auto& zero_sequence() NOEXCEPT
     return sequence;
 }
 
+// An input of an unversioned preimage template (point, empty script, sequence).
+constexpr auto blank_input_size = point::serialized_size() + one +
+    sizeof(uint32_t);
+
+// The signature hash tag prefix (bip341) is one block, so midstate is fixed.
+static const auto& tap_sighash_midstate() NOEXCEPT
+{
+    static const auto state = []() NOEXCEPT
+    {
+        const auto tag = sha256_hash(std::string{ "TapSighash" });
+        accumulator<sha256> context{};
+        context.write(splice(tag, tag));
+        return context.state();
+    }();
+
+    return state;
+}
+
 // Constructors.
 // ----------------------------------------------------------------------------
 
@@ -137,6 +155,28 @@ transaction::transaction(reader& source, bool witness) NOEXCEPT
     assign_data(source, witness);
 }
 
+transaction::transaction(read::bytes::fast&& source, bool witness) NOEXCEPT
+  : transaction(source, witness)
+{
+}
+
+transaction::transaction(read::bytes::fast& source, bool witness) NOEXCEPT
+  : version_(source.read_4_bytes_little_endian()),
+    inputs_(CREATE(input_cptrs, source.get_allocator())),
+    outputs_(CREATE(output_cptrs, source.get_allocator()))
+{
+    assign_data(source, witness);
+}
+
+transaction::transaction(reader& source, bool witness,
+    script_pool& pool) NOEXCEPT
+  : version_(source.read_4_bytes_little_endian()),
+    inputs_(CREATE(input_cptrs, source.get_allocator())),
+    outputs_(CREATE(output_cptrs, source.get_allocator()))
+{
+    assign_data(source, witness, &pool);
+}
+
 // protected
 transaction::transaction(uint32_t version,
     const chain::inputs_cptr& inputs, const chain::outputs_cptr& outputs,
@@ -175,14 +215,36 @@ bool transaction::operator!=(const transaction& other) const NOEXCEPT
 
 // private
 BC_PUSH_WARNING(NO_UNGUARDED_POINTERS)
-void transaction::assign_data(reader& source, bool witness) NOEXCEPT
+template <typename Source>
+void transaction::assign_data(Source& source, bool witness,
+    script_pool* pool) NOEXCEPT
 {
-    auto& allocator = source.get_allocator();
+    byte_allocator& allocator = source.get_allocator();
+
+    // Scripts and witnesses are shared through the pool when provided.
+    const auto read_input = [&]() NOEXCEPT -> input::cptr
+    {
+        if (is_null(pool))
+            return { CREATE(input, allocator, source) };
+
+        reader& from = source;
+        return { CREATE(input, allocator, from, *pool) };
+    };
+
+    const auto read_output = [&]() NOEXCEPT -> output::cptr
+    {
+        if (is_null(pool))
+            return { CREATE(output, allocator, source) };
+
+        reader& from = source;
+        return { CREATE(output, allocator, from, *pool) };
+    };
+
     auto ins = to_non_const_raw_ptr(inputs_);
     auto count = source.read_size(max_block_size);
     ins->reserve(count);
     for (size_t in = 0; in < count; ++in)
-        ins->emplace_back(CREATE(input, allocator, source));
+        ins->emplace_back(read_input());
 
     // Expensive repeated recomputation, so cache segregated state.
     // Detect witness as no inputs (marker) and expected flag (bip144).
@@ -198,16 +260,21 @@ void transaction::assign_data(reader& source, bool witness) NOEXCEPT
         count = source.read_size(max_block_size);
         ins->reserve(count);
         for (size_t in = 0; in < count; ++in)
-            ins->emplace_back(CREATE(input, allocator, source));
+            ins->emplace_back(read_input());
 
         auto outs = to_non_const_raw_ptr(outputs_);
         count = source.read_size(max_block_size);
         outs->reserve(count);
         for (size_t out = 0; out < count; ++out)
-            outs->emplace_back(CREATE(output, allocator, source));
+            outs->emplace_back(read_output());
 
         // Read or skip witnesses as specified.
-        if (witness)
+        if (witness && !is_null(pool))
+        {
+            for (auto& input: *inputs_)
+                to_non_const_raw_ptr(input)->set_witness(source, *pool);
+        }
+        else if (witness)
         {
             for (auto& input: *inputs_)
                 to_non_const_raw_ptr(input)->set_witness(source);
@@ -225,7 +292,7 @@ void transaction::assign_data(reader& source, bool witness) NOEXCEPT
         count = source.read_size(max_block_size);
         outs->reserve(count);
         for (size_t out = 0; out < count; ++out)
-            outs->emplace_back(CREATE(output, allocator, source));
+            outs->emplace_back(read_output());
     }
 
     locktime_ = source.read_4_bytes_little_endian();
@@ -463,6 +530,23 @@ hash_digest transaction::desegregated_hash(size_t witnessed,
     return digest;
 }
 
+// static
+void transaction::desegregate(uint8_t* out, size_t witnessed,
+    size_t unwitnessed, const uint8_t* data) NOEXCEPT
+{
+    if (is_null(out) || is_null(data))
+        return;
+
+    // Same sections as desegregated_hash (version, puts, locktime).
+    constexpr auto preamble = sizeof(uint32_t) + two * sizeof(uint8_t);
+    const auto puts = floored_subtract(unwitnessed, two * sizeof(uint32_t));
+    const auto locktime = floored_subtract(witnessed, sizeof(uint32_t));
+
+    out = std::copy_n(data, sizeof(uint32_t), out);
+    out = std::copy_n(std::next(data, preamble), puts, out);
+    std::copy_n(std::next(data, locktime), sizeof(uint32_t), out);
+}
+
 // Methods.
 // ----------------------------------------------------------------------------
 
@@ -513,12 +597,39 @@ hash_digest transaction::outputs_hash() const NOEXCEPT
     if (sighash_cache_)
         return sighash_cache_->outputs;
 
+    // The double hash (bip143) is the hash of the single hash (bip341).
+    return sha256_hash(single_outputs_hash());
+}
+
+hash_digest transaction::points_hash() const NOEXCEPT
+{
+    if (sighash_cache_)
+        return sighash_cache_->points;
+
+    // The double hash (bip143) is the hash of the single hash (bip341).
+    return sha256_hash(single_points_hash());
+}
+
+hash_digest transaction::sequences_hash() const NOEXCEPT
+{
+    if (sighash_cache_)
+        return sighash_cache_->sequences;
+
+    // The double hash (bip143) is the hash of the single hash (bip341).
+    return sha256_hash(single_sequences_hash());
+}
+
+hash_digest transaction::single_outputs_hash() const NOEXCEPT
+{
+    if (sighash_cache_)
+        return sighash_cache_->single_outputs;
+
     BC_PUSH_WARNING(LOCAL_VARIABLE_NOT_INITIALIZED)
     hash_digest digest;
     BC_POP_WARNING()
-        
+
     stream::out::fast stream{ digest };
-    hash::sha256x2::fast sink{ stream };
+    hash::sha256::fast sink{ stream };
 
     for (const auto& output: *outputs_)
         output->to_data(sink);
@@ -527,17 +638,17 @@ hash_digest transaction::outputs_hash() const NOEXCEPT
     return digest;
 }
 
-hash_digest transaction::points_hash() const NOEXCEPT
+hash_digest transaction::single_points_hash() const NOEXCEPT
 {
     if (sighash_cache_)
-        return sighash_cache_->points;
+        return sighash_cache_->single_points;
 
     BC_PUSH_WARNING(LOCAL_VARIABLE_NOT_INITIALIZED)
     hash_digest digest;
     BC_POP_WARNING()
 
     stream::out::fast stream{ digest };
-    hash::sha256x2::fast sink{ stream };
+    hash::sha256::fast sink{ stream };
 
     for (const auto& input: *inputs_)
         input->point().to_data(sink);
@@ -546,17 +657,17 @@ hash_digest transaction::points_hash() const NOEXCEPT
     return digest;
 }
 
-hash_digest transaction::sequences_hash() const NOEXCEPT
+hash_digest transaction::single_sequences_hash() const NOEXCEPT
 {
     if (sighash_cache_)
-        return sighash_cache_->sequences;
+        return sighash_cache_->single_sequences;
 
     BC_PUSH_WARNING(LOCAL_VARIABLE_NOT_INITIALIZED)
     hash_digest digest;
     BC_POP_WARNING()
 
     stream::out::fast stream{ digest };
-    hash::sha256x2::fast sink{ stream };
+    hash::sha256::fast sink{ stream };
 
     for (const auto& input: *inputs_)
         sink.write_4_bytes_little_endian(input->sequence());
@@ -565,6 +676,46 @@ hash_digest transaction::sequences_hash() const NOEXCEPT
     return digest;
 }
 
+// Requires populated prevouts.
+hash_digest transaction::amounts_hash() const NOEXCEPT
+{
+    if (sighash_cache_ && sighash_cache_->prevouts)
+        return sighash_cache_->amounts;
+
+    BC_PUSH_WARNING(LOCAL_VARIABLE_NOT_INITIALIZED)
+    hash_digest digest;
+    BC_POP_WARNING()
+
+    stream::out::fast stream{ digest };
+    hash::sha256::fast sink{ stream };
+
+    for (const auto& input: *inputs_)
+        sink.write_little_endian(input->prevout->value());
+
+    sink.flush();
+    return digest;
+}
+
+// Requires populated prevouts.
+hash_digest transaction::scripts_hash() const NOEXCEPT
+{
+    if (sighash_cache_ && sighash_cache_->prevouts)
+        return sighash_cache_->scripts;
+
+    BC_PUSH_WARNING(LOCAL_VARIABLE_NOT_INITIALIZED)
+    hash_digest digest;
+    BC_POP_WARNING()
+
+    stream::out::fast stream{ digest };
+    hash::sha256::fast sink{ stream };
+
+    for (const auto& input: *inputs_)
+        input->prevout->script().to_data(sink, prefixed);
+
+    sink.flush();
+    return digest;
+}
+
 // Signing (unversioned).
 // ----------------------------------------------------------------------------
 
@@ -746,8 +897,21 @@ hash_digest transaction::unversioned_signature_hash(
     uint8_t sighash_flags) const NOEXCEPT
 {
     // Set options.
+    const auto anyone = to_bool(sighash_flags & coverage::anyone_can_pay);
     const auto flag = mask_sighash(sighash_flags);
 
+    //*************************************************************************
+    // CONSENSUS: return one_hash if index exceeds outputs in sighash.
+    // Related Bug: bitcointalk.org/index.php?topic=260595
+    // Exploit: joncave.co.uk/2014/08/bitcoin-sighash-single/
+    //*************************************************************************
+    if (flag == coverage::hash_single && input_index(input) >= outputs_->size())
+        return one_hash;
+
+    // Anyone-can-pay preimages include only the signed input.
+    if (unversioned_cache_ && !anyone)
+        return cached_signature_hash(input, sub, sighash_flags);
+
     // Create hash writer.
     BC_PUSH_WARNING(LOCAL_VARIABLE_NOT_INITIALIZED)
     hash_digest digest;
@@ -760,14 +924,6 @@ hash_digest transaction::unversioned_signature_hash(
     {
         case coverage::hash_single:
         {
-            //*****************************************************************
-            // CONSENSUS: return one_hash if index exceeds outputs in sighash.
-            // Related Bug: bitcointalk.org/index.php?topic=260595
-            // Exploit: joncave.co.uk/2014/08/bitcoin-sighash-single/
-            //*****************************************************************
-            if (input_index(input) >= outputs_->size())
-                return one_hash;
-
             signature_hash_single(sink, input, sub, sighash_flags);
             break;
         }
@@ -787,23 +943,201 @@ hash_digest transaction::unversioned_signature_hash(
     return digest;
 }
 
+// private
+// Unversioned preimages of distinct inputs (excluding anyone-can-pay) differ
+// only in the signed input's script (and sequence when none/single). Each is
+// hashed from the midstate of its template prefix, with the remainder written
+// from the template rather than reserialized from the transaction.
+hash_digest transaction::cached_signature_hash(const input_iterator& input,
+    const script& sub, uint8_t sighash_flags) const NOEXCEPT
+{
+    constexpr auto block_size = array_count<sha256::block_t>;
+    constexpr auto sequence_size = sizeof(uint32_t);
+
+    // Set options.
+    const auto flag = mask_sighash(sighash_flags);
+    const auto all = (flag == coverage::hash_all);
+
+    const auto& cache = *unversioned_cache_;
+    const auto& preimage = all ? cache.all : cache.none;
+    const auto& states = all ? cache.all_states : cache.none_states;
+
+    // Position of the signed input's (empty) script in the template.
+    const auto index = input_index(input);
+    const auto script = cache.inputs + index * blank_input_size +
+        point::serialized_size();
+    const auto blocks = script / block_size;
+    const auto start = blocks * block_size;
+    const auto data = preimage.data();
+
+    // Create hash writer from the prefix midstate.
+    BC_PUSH_WARNING(LOCAL_VARIABLE_NOT_INITIALIZED)
+    hash_digest digest;
+    BC_POP_WARNING()
+
+    stream::out::fast stream{ digest };
+    hash::sha256x2::fast sink{ stream, states[blocks], blocks };
+
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    sink.write_bytes(std::next(data, start), script - start);
+    sub.to_data(sink, prefixed);
+
+    if (all)
+    {
+        // Signed sequence, remaining inputs, outputs and locktime.
+        const auto rest = add1(script);
+        sink.write_bytes(std::next(data, rest), preimage.size() - rest);
+    }
+    else
+    {
+        const auto rest = add1(script) + sequence_size;
+        sink.write_4_bytes_little_endian((*input)->sequence());
+        sink.write_bytes(std::next(data, rest), preimage.size() - rest);
+
+        if (flag == coverage::hash_single)
+        {
+            // Guarded by unversioned_signature_hash.
+            sink.write_variable(add1(index));
+            for (size_t output = 0; output < index; ++output)
+                sink.write_bytes(null_output());
+
+            outputs_->at(index)->to_data(sink);
+        }
+        else
+        {
+            sink.write_variable(zero);
+        }
+
+        sink.write_4_bytes_little_endian(locktime_);
+    }
+    BC_POP_WARNING()
+
+    sink.write_4_bytes_little_endian(sighash_flags);
+    sink.flush();
+    return digest;
+}
+
+// private
+// Templates serialize all inputs with empty scripts (and zero sequences for
+// none/single). Midstates are retained for each block of the input region.
+transaction::unversioned_cache
+transaction::unversioned_preimages() const NOEXCEPT
+{
+    constexpr auto block_size = array_count<sha256::block_t>;
+    const auto inputs = sizeof(version_) + variable_size(inputs_->size());
+    const auto size = inputs + inputs_->size() * blank_input_size;
+
+    const auto outputs = std::accumulate(outputs_->begin(), outputs_->end(),
+        variable_size(outputs_->size()), [](size_t total, const auto& output)
+        NOEXCEPT
+        {
+            return ceilinged_add(total, output->serialized_size());
+        });
+
+    unversioned_cache cache
+    {
+        inputs,
+        data_chunk(size + outputs + sizeof(locktime_)),
+        data_chunk(size),
+        {},
+        {}
+    };
+
+    const auto write_inputs = [this](writer& sink, bool none) NOEXCEPT
+    {
+        sink.write_4_bytes_little_endian(version_);
+        sink.write_variable(inputs_->size());
+        for (const auto& input: *inputs_)
+        {
+            input->point().to_data(sink);
+            sink.write_bytes(empty_script());
+            if (none)
+                sink.write_bytes(zero_sequence());
+            else
+                sink.write_4_bytes_little_endian(input->sequence());
+        }
+    };
+
+    stream::out::copy all_stream(cache.all);
+    write::bytes::ostream all(all_stream);
+    write_inputs(all, false);
+    all.write_variable(outputs_->size());
+    for (const auto& output: *outputs_)
+        output->to_data(all);
+
+    all.write_4_bytes_little_endian(locktime_);
+    all.flush();
+
+    stream::out::copy none_stream(cache.none);
+    write::bytes::ostream none(none_stream);
+    write_inputs(none, true);
+    none.flush();
+
+    const auto midstates = [size](const data_chunk& preimage) NOEXCEPT
+    {
+        accumulator<sha256> context{};
+        transaction::midstates states{ context.state() };
+        states.reserve(add1(size / block_size));
+
+        BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+        for (auto block = zero; block + block_size <= size; block += block_size)
+        {
+            context.write(block_size, std::next(preimage.data(), block));
+            states.push_back(context.state());
+        }
+        BC_POP_WARNING()
+
+        return states;
+    };
+
+    cache.all_states = midstates(cache.all);
+    cache.none_states = midstates(cache.none);
+    return cache;
+}
+
 // Signing (version 0).
 // ----------------------------------------------------------------------------
 
-// private
-// TODO: taproot requires both single and double hash of each.
 void transaction::initialize_sighash_cache() const NOEXCEPT
 {
+    // Unversioned signature hashing is quadratic in the number of inputs.
+    // Native witness spends have empty input scripts and do not require it.
+    const auto unversioned = [](const auto& input) NOEXCEPT
+    {
+        return !input->script().ops().empty();
+    };
+
+    if (!unversioned_cache_ && inputs_->size() > one &&
+        std::any_of(inputs_->begin(), inputs_->end(), unversioned))
+        unversioned_cache_ = unversioned_preimages();
+
     // C++23: std::optional<T>::or_else.
     if (!segregated_)
         return;
 
+    // Prevouts may be populated after a prior initialization.
+    const auto prevouts = !is_coinbase() && !is_missing_prevouts();
+    if (sighash_cache_ && (sighash_cache_->prevouts || !prevouts))
+        return;
+
+    // Single hashes (bip341) are computed once and double hashed (bip143).
     // This overconstructs the cache (anyone or !all), however it is simple.
+    sighash_cache_.reset();
+    const auto outputs = single_outputs_hash();
+    const auto points = single_points_hash();
+    const auto sequences = single_sequences_hash();
+
     sighash_cache_ =
     {
-        outputs_hash(),
-        points_hash(),
-        sequences_hash()
+        sha256_hash(outputs),
+        sha256_hash(points),
+        sha256_hash(sequences),
+        outputs,
+        points,
+        sequences,
+        prevouts ? amounts_hash() : null_hash,
+        prevouts ? scripts_hash() : null_hash,
+        prevouts
     };
 }
 
@@ -882,6 +1216,133 @@ hash_digest transaction::version_0_signature_hash(const input_iterator& input,
     return digest;
 }
 
+// Signing (version 1).
+// ----------------------------------------------------------------------------
+
+// Unlike unversioned and v0, undefined sighash types are invalid (bip341).
+inline bool is_version_1_sighash(uint8_t sighash_flags) NOEXCEPT
+{
+    switch (sighash_flags)
+    {
+        case coverage::hash_default:
+        case coverage::hash_all:
+        case coverage::hash_none:
+        case coverage::hash_single:
+        case coverage::all_anyone_can_pay:
+        case coverage::none_anyone_can_pay:
+        case coverage::single_anyone_can_pay:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool transaction::signature_hash(hash_digest& out,
+    const input_iterator& input, uint8_t sighash_flags) const NOEXCEPT
+{
+    // There is no rational interpretation of a signature hash for a coinbase.
+    BC_ASSERT(!is_coinbase());
+
+    if (!is_version_1_sighash(sighash_flags))
+        return false;
+
+    // Single requires a corresponding output (bip341).
+    const auto flag = bit_and<uint8_t>(sighash_flags, coverage::hash_single);
+    if (flag == coverage::hash_single &&
+        input_index(input) >= outputs_->size())
+        return false;
+
+    // All prevouts (amounts and scripts) are committed (bip341).
+    if (!(sighash_cache_ && sighash_cache_->prevouts) && is_missing_prevouts())
+        return false;
+
+    out = version_1_signature_hash(input, sighash_flags);
+    return true;
+}
+
+// private
+// Key path spend (ext_flag zero), with sighash flags validated (bip341).
+hash_digest transaction::version_1_signature_hash(const input_iterator& input,
+    uint8_t sighash_flags) const NOEXCEPT
+{
+    // Set options.
+    const auto anyone = to_bool(sighash_flags & coverage::anyone_can_pay);
+    const auto flag = bit_and<uint8_t>(sighash_flags, coverage::hash_single);
+    const auto single = (flag == coverage::hash_single);
+    const auto none = (flag == coverage::hash_none);
+    const auto& in = **input;
+    const auto& stack = in.witness().stack();
+    const auto annex = witness::is_annex_pattern(stack);
+
+    // Create hash writer, resumed from the tag prefix midstate.
+    BC_PUSH_WARNING(LOCAL_VARIABLE_NOT_INITIALIZED)
+    hash_digest digest;
+    BC_POP_WARNING()
+
+    stream::out::fast stream{ digest };
+    hash::sha256::fast sink{ stream, tap_sighash_midstate(), one };
+
+    // Create signature hash.
+    sink.write_byte(taproot_sighash_epoch);
+    sink.write_byte(sighash_flags);
+    sink.write_little_endian(version_);
+    sink.write_little_endian(locktime_);
+
+    // points, amounts, scripts, sequences
+    if (!anyone)
+    {
+        sink.write_bytes(single_points_hash());
+        sink.write_bytes(amounts_hash());
+        sink.write_bytes(scripts_hash());
+        sink.write_bytes(single_sequences_hash());
+    }
+
+    // outputs
+    if (!single && !none)
+        sink.write_bytes(single_outputs_hash());
+
+    // spend_type (ext_flag is zero for key path).
+    sink.write_byte(to_int<uint8_t>(annex));
+
+    if (anyone)
+    {
+        in.point().to_data(sink);
+        sink.write_little_endian(in.prevout->value());
+        in.prevout->script().to_data(sink, prefixed);
+        sink.write_little_endian(in.sequence());
+    }
+    else
+    {
+        sink.write_little_endian(input_index(input));
+    }
+
+    // The annex is hashed with its size prefix.
+    if (annex)
+    {
+        hash_digest annex_hash{};
+        stream::out::fast annex_stream{ annex_hash };
+        hash::sha256::fast annex_sink{ annex_stream };
+        annex_sink.write_variable(stack.back()->size());
+        annex_sink.write_bytes(*stack.back());
+        annex_sink.flush();
+        sink.write_bytes(annex_hash);
+    }
+
+    // output (index validated by caller).
+    if (single)
+    {
+        hash_digest output_hash{};
+        stream::out::fast output_stream{ output_hash };
+        hash::sha256::fast output_sink{ output_stream };
+        outputs_->at(input_index(input))->to_data(output_sink);
+        output_sink.flush();
+        sink.write_bytes(output_hash);
+    }
+
+    sink.flush();
+    return digest;
+}
+
 // Signing (unversioned and version 0).
 // ----------------------------------------------------------------------------
 
@@ -904,6 +1365,7 @@ hash_digest transaction::signature_hash(const input_iterator& input,
         case script_version::zero:
             return version_0_signature_hash(input, sub, value, sighash_flags,
                 bip143);
+        case script_version::one:
         case script_version::reserved:
         default:
             return {};
@@ -1336,26 +1798,240 @@ code transaction::connect(const context& ctx) const NOEXCEPT
     if (is_coinbase())
         return error::transaction_success;
 
-    code ec{};
-    using namespace machine;
     initialize_sighash_cache();
 
     // Validate scripts.
     for (auto input = inputs_->begin(); input != inputs_->end(); ++input)
-    {
-        // Evaluate rolling scripts with linear search but constant erase.
-        // Evaluate non-rolling scripts with constant search but linear erase.
-        if ((ec = (*input)->is_roller() ?
-            interpreter<linked_stack>::connect(ctx, *this, input) :
-            interpreter<contiguous_stack>::connect(ctx, *this, input)))
+        if (const auto ec = connect_input(ctx, input))
             return ec;
-    }
 
     // TODO: accumulate sigops from each connect result and add coinbase.
     // TODO: return in override with out parameter. more impactful with segwit.
     return error::transaction_success;
 }
 
+// Do not need to invoke on coinbase.
+code transaction::connect(const context& ctx,
+    signature_batch& batch) const NOEXCEPT
+{
+    if (is_coinbase())
+        return error::transaction_success;
+
+    using namespace machine;
+    initialize_sighash_cache();
+
+    // Validate scripts, deferring terminal signature verification.
+    for (auto input = inputs_->begin(); input != inputs_->end(); ++input)
+    {
+        if (const auto ec = (*input)->is_roller() ?
+            interpreter<linked_stack>::connect(ctx, *this, input, batch) :
+            interpreter<contiguous_stack>::connect(ctx, *this, input, batch))
+            return ec;
+    }
+
+    return error::transaction_success;
+}
+
+// Do not need to invoke on coinbase.
+code transaction::connect(const context& ctx,
+    script_cache& cache) const NOEXCEPT
+{
+    if (is_coinbase())
+        return error::transaction_success;
+
+    uint32_t index{};
+    const auto key = hash(true);
+    initialize_sighash_cache();
+
+    // Validate uncached scripts.
+    for (auto input = inputs_->begin(); input != inputs_->end(); ++input)
+    {
+        if (!cache.find(key, index, ctx.flags))
+        {
+            if (const auto ec = connect_input(ctx, input))
+                return ec;
+
+            cache.store(key, index, ctx.flags);
+        }
+
+        ++index;
+    }
+
+    return error::transaction_success;
+}
+
+// Does not invoke initialize_sighash_cache (caller must for thread safety).
+code transaction::connect_input(const context& ctx,
+    const input_iterator& input) const NOEXCEPT
+{
+    using namespace machine;
+
+    // Standard key hash spends are verified without script evaluation.
+    if (connect_template(ctx, input))
+        return error::script_success;
+
+    // Evaluate rolling scripts with linear search but constant erase.
+    // Evaluate non-rolling scripts with constant search but linear erase.
+    return (*input)->is_roller() ?
+        interpreter<linked_stack>::connect(ctx, *this, input) :
+        interpreter<contiguous_stack>::connect(ctx, *this, input);
+}
+
+// Connect (template fast path).
+// ----------------------------------------------------------------------------
+// Inputs spending standard key hash templates are verified directly, without
+// program construction or script evaluation. A false result does not imply
+// failure, only that the input must be interpreted. Any irregularity returns
+// false, so that all failure codes are produced by the interpreter.
+
+// Push data as seen by the interpreter, or null if not a simple data push.
+// Underflow ops carry an invalid opcode, so are never payloads.
+inline const data_chunk* payload(const operation& op) NOEXCEPT
+{
+    return op.is_payload() && !op.is_underclaimed() && !op.is_oversized() ?
+        &op.data() : nullptr;
+}
+
+// Witness elements are limited to push size (bip141).
+inline bool is_key_hash_witness(const chunk_cptrs& stack) NOEXCEPT
+{
+    return stack.size() == two &&
+        stack.front()->size() <= max_push_data_size &&
+        stack.back()->size() <= max_push_data_size;
+}
+
+// Serialized p2wpkh script, as embedded by p2sh-p2wpkh.
+inline bool is_witness_key_hash(const data_chunk& script) NOEXCEPT
+{
+    constexpr auto version = static_cast<uint8_t>(opcode::push_size_0);
+    constexpr auto push = static_cast<uint8_t>(opcode::push_size_20);
+    return script.size() == add1(add1(short_hash_size)) &&
+        script.front() == version && script.at(one) == push;
+}
+
+bool transaction::connect_template(const context& ctx,
+    const input_iterator& input) const NOEXCEPT
+{
+    const auto& in = **input;
+    if (!in.prevout)
+        return false;
+
+    const auto& prevout = in.prevout->script();
+    const auto& outs = prevout.ops();
+    const auto& ins = in.script().ops();
+    if (prevout.is_prefail() || in.script().is_prefail() ||
+        in.script().is_oversized())
+        return false;
+
+    // p2wpkh: <0> <20-byte-hash-of-public-key>
+    if (script::is_pay_witness_key_hash_pattern(outs))
+        return script::is_enabled(ctx.flags, flags::bip141_rule) &&
+            ins.empty() && connect_witness_key_hash(ctx, input,
+                outs.back().data());
+
+    switch (prevout.output_pattern())
+    {
+        // p2pkh: dup hash160 <20-byte-hash> equalverify checksig
+        case script_pattern::pay_key_hash:
+        {
+            BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+            const auto& hash = outs[2];
+            BC_POP_WARNING()
+
+            if (ins.size() != two || !in.witness().stack().empty() ||
+                hash.code() != opcode::push_size_20)
+                return false;
+
+            const auto endorsement = payload(ins.front());
+            const auto key = payload(ins.back());
+            if (is_null(endorsement) || is_null(key))
+                return false;
+
+            // Subscript stripping applies if the endorsement matches the hash.
+            if (*endorsement == hash.data())
+                return false;
+
+            // The prevout script is the (unstripped) subscript.
+            return connect_key_hash(input, *endorsement, *key,
+                to_array<short_hash_size>(hash.data()), prevout, max_uint64,
+                script_version::unversioned, ctx.flags);
+        }
+
+        // p2sh-p2wpkh: hash160 <20-byte-hash> equal
+        case script_pattern::pay_script_hash:
+        {
+            if (!script::is_enabled(ctx.flags, flags::bip16_rule) ||
+                !script::is_enabled(ctx.flags, flags::bip141_rule) ||
+                ins.size() != one)
+                return false;
+
+            // Embedded script must be exactly: <0> <20-byte-hash>.
+            const auto embedded = payload(ins.front());
+            if (is_null(embedded) || !is_witness_key_hash(*embedded))
+                return false;
+
+            if (bitcoin_short_hash(*embedded) !=
+                to_array<short_hash_size>(std::next(outs.begin())->data()))
+                return false;
+
+            const data_chunk program{ std::next(embedded->begin(), two),
+                embedded->end() };
+
+            return connect_witness_key_hash(ctx, input, program);
+        }
+
+        default:
+            return false;
+    }
+}
+
+bool transaction::connect_witness_key_hash(const context& ctx,
+    const input_iterator& input, const data_chunk& program) const NOEXCEPT
+{
+    // bip143 sighash is required, the program must evaluate true.
+    if (!script::is_enabled(ctx.flags, flags::bip143_rule) ||
+        program.size() != short_hash_size ||
+        !machine::number::boolean::from_chunk(program))
+        return false;
+
+    const auto& stack = (*input)->witness().stack();
+    if (!is_key_hash_witness(stack))
+        return false;
+
+    // The witness subscript is not stripped (bip143).
+    const auto hash = to_array<short_hash_size>(program);
+    const script sub{ script::to_pay_key_hash_pattern(hash) };
+    return connect_key_hash(input, *stack.front(), *stack.back(), hash, sub,
+        (*input)->prevout->value(), script_version::zero, ctx.flags);
+}
+
+bool transaction::connect_key_hash(const input_iterator& input,
+    const data_chunk& endorsement, const data_chunk& key,
+    const short_hash& hash, const script& sub, uint64_t value,
+    script_version version, uint32_t active_flags) const NOEXCEPT
+{
+    // op_equalverify and op_checksig empty element failures.
+    if (endorsement.empty() || key.empty() || bitcoin_short_hash(key) != hash)
+        return false;
+
+    uint8_t sighash_flags;
+    data_slice distinguished;
+    if (!parse_endorsement(sighash_flags, distinguished, endorsement))
+        return false;
+
+    // Parse DER signature into an EC signature (bip66 sets strict).
+    ec_signature signature;
+    const auto bip66 = script::is_enabled(active_flags, flags::bip66_rule);
+    if (!parse_signature(signature, distinguished, bip66))
+        return false;
+
+    const auto bip143 = script::is_enabled(active_flags, flags::bip143_rule);
+    const auto sighash = signature_hash(input, sub, value, sighash_flags,
+        version, bip143);
+
+    return verify_signature(key, sighash, signature);
+}
+
 BC_POP_WARNING()
 
 // JSON value convertors.
@@ -0,0 +1,387 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/transaction_view.hpp>
+
+#include <iterator>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// Views parse with a fast reader over the viewed buffer, which does not
+// allocate. Only offsets are retained, elements are read on access.
+
+constexpr auto sequence_size = sizeof(uint32_t);
+constexpr auto value_size = sizeof(uint64_t);
+
+// Skip a size-prefixed script, as if deserialized.
+inline void skip_script(reader& source) NOEXCEPT
+{
+    source.skip_bytes(source.read_size(max_block_size));
+}
+
+inline void skip_input(reader& source) NOEXCEPT
+{
+    source.skip_bytes(point::serialized_size());
+    skip_script(source);
+    source.skip_bytes(sequence_size);
+}
+
+inline void skip_output(reader& source) NOEXCEPT
+{
+    source.skip_bytes(value_size);
+    skip_script(source);
+}
+
+inline data_slice to_slice(const data_slice& data, size_t size) NOEXCEPT
+{
+    return { data.begin(), std::next(data.begin(), size) };
+}
+
+// input_view
+// ----------------------------------------------------------------------------
+
+input_view::input_view() NOEXCEPT
+  : data_{}, script_{}, valid_(false)
+{
+}
+
+input_view::input_view(const data_slice& data) NOEXCEPT
+  : input_view()
+{
+    stream::in::fast stream{ data };
+    read::bytes::fast source{ stream };
+    source.skip_bytes(point::serialized_size());
+    const auto size = source.read_size(max_block_size);
+    script_ = source.get_read_position();
+    source.skip_bytes(size);
+    source.skip_bytes(sequence_size);
+
+    if (!source)
+        return;
+
+    data_ = to_slice(data, source.get_read_position());
+    valid_ = true;
+}
+
+bool input_view::is_valid() const NOEXCEPT
+{
+    return valid_;
+}
+
+size_t input_view::serialized_size() const NOEXCEPT
+{
+    return data_.size();
+}
+
+chain::point input_view::point() const NOEXCEPT
+{
+    if (!valid_)
+        return {};
+
+    return { unsafe_array_cast<uint8_t, hash_size>(data_.data()),
+        point_index() };
+}
+
+uint32_t input_view::point_index() const NOEXCEPT
+{
+    if (!valid_)
+        return point::null_index;
+
+    return from_little_endian(unsafe_array_cast<uint8_t, sizeof(uint32_t)>(
+        std::next(data_.data(), hash_size)));
+}
+
+data_slice input_view::point_hash() const NOEXCEPT
+{
+    if (!valid_)
+        return {};
+
+    return to_slice(data_, hash_size);
+}
+
+data_slice input_view::script() const NOEXCEPT
+{
+    if (!valid_)
+        return {};
+
+    return { std::next(data_.begin(), script_),
+        std::prev(data_.end(), sequence_size) };
+}
+
+uint32_t input_view::sequence() const NOEXCEPT
+{
+    if (!valid_)
+        return {};
+
+    return from_little_endian(unsafe_array_cast<uint8_t, sequence_size>(
+        std::prev(data_.end(), sequence_size)));
+}
+
+data_slice input_view::data() const NOEXCEPT
+{
+    return data_;
+}
+
+chain::input input_view::to_input() const NOEXCEPT
+{
+    stream::in::fast stream{ data_ };
+    return { stream };
+}
+
+// output_view
+// ----------------------------------------------------------------------------
+
+output_view::output_view() NOEXCEPT
+  : data_{}, script_{}, valid_(false)
+{
+}
+
+output_view::output_view(const data_slice& data) NOEXCEPT
+  : output_view()
+{
+    stream::in::fast stream{ data };
+    read::bytes::fast source{ stream };
+    source.skip_bytes(value_size);
+    const auto size = source.read_size(max_block_size);
+    script_ = source.get_read_position();
+    source.skip_bytes(size);
+
+    if (!source)
+        return;
+
+    data_ = to_slice(data, source.get_read_position());
+    valid_ = true;
+}
+
+bool output_view::is_valid() const NOEXCEPT
+{
+    return valid_;
+}
+
+size_t output_view::serialized_size() const NOEXCEPT
+{
+    return data_.size();
+}
+
+uint64_t output_view::value() const NOEXCEPT
+{
+    if (!valid_)
+        return output::not_found;
+
+    return from_little_endian(unsafe_array_cast<uint8_t, value_size>(
+        data_.data()));
+}
+
+data_slice output_view::script() const NOEXCEPT
+{
+    if (!valid_)
+        return {};
+
+    return { std::next(data_.begin(), script_), data_.end() };
+}
+
+data_slice output_view::data() const NOEXCEPT
+{
+    return data_;
+}
+
+chain::output output_view::to_output() const NOEXCEPT
+{
+    stream::in::fast stream{ data_ };
+    return { stream };
+}
+
+// transaction_view
+// ----------------------------------------------------------------------------
+
+transaction_view::transaction_view() NOEXCEPT
+  : data_{},
+    puts_{},
+    inputs_{},
+    outputs_{},
+    inputs_offset_{},
+    outputs_offset_{},
+    nominal_{},
+    segregated_(false),
+    valid_(false)
+{
+}
+
+transaction_view::transaction_view(const data_slice& data) NOEXCEPT
+  : transaction_view()
+{
+    stream::in::fast stream{ data };
+    read::bytes::fast source{ stream };
+    source.skip_bytes(sizeof(uint32_t));
+
+    // Detect witness as no inputs (marker) and expected flag (bip144).
+    auto start = source.get_read_position();
+    auto inputs = source.read_size(max_block_size);
+    const auto segregated =
+        inputs == witness_marker &&
+        source.peek_byte() == witness_enabled;
+
+    if (segregated)
+    {
+        // Skip over the peeked witness flag.
+        source.skip_byte();
+        start = source.get_read_position();
+        inputs = source.read_size(max_block_size);
+    }
+
+    // Count prefixes may not be minimally encoded, so offsets are recorded.
+    const auto inputs_offset = source.get_read_position() - start;
+    for (size_t in = 0; in < inputs; ++in)
+        skip_input(source);
+
+    const auto outputs = source.read_size(max_block_size);
+    const auto outputs_offset = source.get_read_position() - start;
+
+    for (size_t out = 0; out < outputs; ++out)
+        skip_output(source);
+
+    const auto stop = source.get_read_position();
+
+    if (segregated)
+    {
+        for (size_t in = 0; in < inputs; ++in)
+            witness::skip(source, true);
+    }
+
+    source.skip_bytes(sizeof(uint32_t));
+    if (!source)
+        return;
+
+    data_ = to_slice(data, source.get_read_position());
+    puts_ = { std::next(data.begin(), start), std::next(data.begin(), stop) };
+    inputs_ = inputs;
+    outputs_ = outputs;
+    inputs_offset_ = inputs_offset;
+    outputs_offset_ = outputs_offset;
+    nominal_ = sizeof(uint32_t) + puts_.size() + sizeof(uint32_t);
+    segregated_ = segregated;
+    valid_ = true;
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+bool transaction_view::is_valid() const NOEXCEPT
+{
+    return valid_;
+}
+
+bool transaction_view::is_segregated() const NOEXCEPT
+{
+    return segregated_;
+}
+
+// Same as transaction::is_coinbase (single input with null point).
+bool transaction_view::is_coinbase() const NOEXCEPT
+{
+    return is_one(inputs_) && inputs().begin()->point().is_null();
+}
+
+size_t transaction_view::serialized_size(bool witness) const NOEXCEPT
+{
+    return witness ? data_.size() : nominal_;
+}
+
+uint32_t transaction_view::version() const NOEXCEPT
+{
+    if (!valid_)
+        return {};
+
+    return from_little_endian(unsafe_array_cast<uint8_t, sizeof(uint32_t)>(
+        data_.data()));
+}
+
+uint32_t transaction_view::locktime() const NOEXCEPT
+{
+    if (!valid_)
+        return {};
+
+    return from_little_endian(unsafe_array_cast<uint8_t, sizeof(uint32_t)>(
+        std::prev(data_.end(), sizeof(uint32_t))));
+}
+
+input_views transaction_view::inputs() const NOEXCEPT
+{
+    return { { std::next(puts_.begin(), inputs_offset_), puts_.end() },
+        inputs_ };
+}
+
+output_views transaction_view::outputs() const NOEXCEPT
+{
+    return { { std::next(puts_.begin(), outputs_offset_), puts_.end() },
+        outputs_ };
+}
+
+hash_digest transaction_view::hash(bool witness) const NOEXCEPT
+{
+    if (!valid_)
+        return null_hash;
+
+    if (segregated_)
+    {
+        if (witness)
+        {
+            // Witness coinbase tx hash is assumed to be null_hash (bip141).
+            if (is_coinbase())
+                return null_hash;
+        }
+        else
+        {
+            return transaction::desegregated_hash(data_.size(), nominal_,
+                data_.data());
+        }
+    }
+
+    return bitcoin_hash(data_.size(), data_.data());
+}
+
+data_slice transaction_view::data() const NOEXCEPT
+{
+    return data_;
+}
+
+chain::transaction transaction_view::to_transaction(bool witness) const NOEXCEPT
+{
+    stream::in::fast stream{ data_ };
+    return { stream, witness };
+}
+
+BC_POP_WARNING()
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
@@ -108,6 +108,17 @@ witness::witness(reader& source, bool prefix) NOEXCEPT
     assign_data(source, prefix);
 }
 
+witness::witness(read::bytes::fast&& source, bool prefix) NOEXCEPT
+  : witness(source, prefix)
+{
+}
+
+witness::witness(read::bytes::fast& source, bool prefix) NOEXCEPT
+  : stack_(source.get_arena())
+{
+    assign_data(source, prefix);
+}
+
 witness::witness(const std::string& mnemonic) NOEXCEPT
   : witness(from_string(mnemonic))
 {
@@ -147,27 +158,39 @@ bool witness::operator!=(const witness& other) const NOEXCEPT
 // Deserialization.
 // ----------------------------------------------------------------------------
 
-void witness::skip(reader& source, bool prefix) NOEXCEPT
+template <typename Source>
+static void skip_witness(Source& source, bool prefix) NOEXCEPT
 {
     if (prefix)
     {
         const auto count = source.read_size(max_block_weight);
 
         for (size_t element = 0; element < count; ++element)
-            source.read_bytes(source.read_size(max_block_weight));
+            source.skip_bytes(source.read_size(max_block_weight));
     }
     else
     {
         while (!source.is_exhausted())
-            source.read_bytes(source.read_size(max_block_weight));
+            source.skip_bytes(source.read_size(max_block_weight));
     }
 }
 
+void witness::skip(reader& source, bool prefix) NOEXCEPT
+{
+    skip_witness(source, prefix);
+}
+
+void witness::skip(read::bytes::fast& source, bool prefix) NOEXCEPT
+{
+    skip_witness(source, prefix);
+}
+
 // private
-void witness::assign_data(reader& source, bool prefix) NOEXCEPT
+template <typename Source>
+void witness::assign_data(Source& source, bool prefix) NOEXCEPT
 {
     size_ = zero;
-    auto& allocator = source.get_allocator();
+    byte_allocator& allocator = source.get_allocator();
 
     if (prefix)
     {
@@ -360,6 +383,7 @@ bool witness::extract_sigop_script(script& out_script,
         }
 
         // These versions are reserved for future extensions (bip141).
+        case script_version::one:
         case script_version::reserved:
             return true;
 
@@ -424,6 +448,7 @@ bool witness::extract_script(script::cptr& out_script,
         }
 
         // These versions are reserved for future extensions (bip141).
+        case script_version::one:
         case script_version::reserved:
             return true;
 
@@ -19,8 +19,11 @@
  */
 #include <bitcoin/system/crypto/aes256.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/math/math.hpp>
 
 namespace libbitcoin {
@@ -390,11 +393,435 @@ constexpr void decrypt_block(aes256::context& context, block& bytes) NOEXCEPT
 ////    context.deckey.fill(0);
 ////}
 
+// bulk
+// ----------------------------------------------------------------------------
+// The context (or key schedule) is initialized once for the whole sequence.
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+inline block& block_at(const data_slab& bytes, size_t offset) NOEXCEPT
+{
+    return unsafe_array_cast<uint8_t, block_size>(
+        std::next(bytes.data(), offset));
+}
+
+constexpr void xor_block(block& bytes, const block& other) NOEXCEPT
+{
+    auto i = block_size;
+    while (to_bool(i--))
+        bytes[i] ^= other[i];
+}
+
+// Apply key stream to the (possibly partial) block at offset.
+inline void xor_stream(const data_slab& bytes, size_t offset,
+    const block& stream) NOEXCEPT
+{
+    const auto to = std::next(bytes.data(), offset);
+    const auto count = std::min(block_size, bytes.size() - offset);
+    for (size_t i = 0; i < count; ++i)
+        to[i] ^= stream[i];
+}
+
+// Big-endian 128 bit increment (wraps to zero).
+constexpr void increment(block& counter) NOEXCEPT
+{
+    auto i = block_size;
+    while (to_bool(i--) && is_zero(++counter[i]));
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+template <bool Encrypt>
+void ecb_portable(const data_slab& bytes, const secret& key) NOEXCEPT
+{
+    aes256::context context;
+    initialize(context, key);
+
+    for (size_t offset{}; offset < bytes.size(); offset += block_size)
+    {
+        if constexpr (Encrypt)
+            encrypt_block(context, block_at(bytes, offset));
+        else
+            decrypt_block(context, block_at(bytes, offset));
+    }
+}
+
+void encrypt_cbc_portable(const data_slab& bytes, const secret& key,
+    const block& iv) NOEXCEPT
+{
+    aes256::context context;
+    initialize(context, key);
+
+    auto prior = iv;
+    for (size_t offset{}; offset < bytes.size(); offset += block_size)
+    {
+        auto& bytes_ = block_at(bytes, offset);
+        xor_block(bytes_, prior);
+        encrypt_block(context, bytes_);
+        prior = bytes_;
+    }
+}
+
+void decrypt_cbc_portable(const data_slab& bytes, const secret& key,
+    const block& iv) NOEXCEPT
+{
+    aes256::context context;
+    initialize(context, key);
+
+    auto prior = iv;
+    for (size_t offset{}; offset < bytes.size(); offset += block_size)
+    {
+        auto& bytes_ = block_at(bytes, offset);
+        const auto cipher = bytes_;
+        decrypt_block(context, bytes_);
+        xor_block(bytes_, prior);
+        prior = cipher;
+    }
+}
+
+void ctr_portable(const data_slab& bytes, const secret& key,
+    const block& counter) NOEXCEPT
+{
+    aes256::context context;
+    initialize(context, key);
+
+    block stream{};
+    auto count = counter;
+    for (size_t offset{}; offset < bytes.size(); offset += block_size)
+    {
+        stream = count;
+        encrypt_block(context, stream);
+        xor_stream(bytes, offset, stream);
+        increment(count);
+    }
+}
+
+// aes-ni (and vaes)
+// ----------------------------------------------------------------------------
+// Independent blocks (ecb, ctr, cbc decryption) are pipelined across lanes so
+// that the multi-cycle latency of each aes round instruction is overlapped.
+
+#if defined(HAVE_AESNI)
+
+// Compiled intrinsics require runtime confirmation, evaluated once.
+inline bool have_aesni() NOEXCEPT
+{
+    static const auto have = try_aesni();
+    return have;
+}
+
+#if defined(HAVE_VAES)
+inline bool have_vaes() NOEXCEPT
+{
+    static const auto have = try_vaes();
+    return have;
+}
+#endif
+
+constexpr size_t pipeline = 8;
+
+template <typename xWord>
+using xkeys = std_array<xWord, add1(rounds)>;
+using keys128 = xkeys<xint128_t>;
+
+template <typename xWord, size_t Lanes>
+using xlanes = std_array<xWord, Lanes>;
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+template <typename xWord>
+INLINE xWord load_at(const data_slab& bytes, size_t offset) NOEXCEPT
+{
+    return load(unsafe_array_cast<uint8_t, sizeof(xWord)>(
+        std::next(bytes.data(), offset)));
+}
+
+template <typename xWord>
+INLINE void store_at(const data_slab& bytes, size_t offset,
+    xWord value) NOEXCEPT
+{
+    store(unsafe_array_cast<uint8_t, sizeof(xWord)>(
+        std::next(bytes.data(), offset)), value);
+}
+
+INLINE xint128_t mix_key(xint128_t key) NOEXCEPT
+{
+    // Prefix xor of the four key words (w0, w0^w1, w0^w1^w2, w0^w1^w2^w3).
+    key = f::xor_(key, mm_slli_si128(key, 4));
+    return f::xor_(key, mm_slli_si128(key, 8));
+}
+
+template <int Round>
+INLINE xint128_t next_even(xint128_t key, xint128_t prior) NOEXCEPT
+{
+    // RotWord(SubWord(w[i-1])) ^ rcon, broadcast from the high word.
+    return f::xor_(mix_key(key),
+        mm_shuffle_epi32(aes_key_assist<Round>(prior), 0xff));
+}
+
+INLINE xint128_t next_odd(xint128_t key, xint128_t prior) NOEXCEPT
+{
+    // SubWord(w[i-1]), broadcast from the high word.
+    return f::xor_(mix_key(key),
+        mm_shuffle_epi32(aes_key_assist<0>(prior), 0xaa));
+}
+
+INLINE void expand_encrypt(keys128& keys, const secret& key) NOEXCEPT
+{
+    keys[0]  = load(unsafe_array_cast<uint8_t, block_size>(key.data()));
+    keys[1]  = load(unsafe_array_cast<uint8_t, block_size>(
+        std::next(key.data(), block_size)));
+    keys[2]  = next_even<0x01>(keys[0], keys[1]);
+    keys[3]  = next_odd(keys[1], keys[2]);
+    keys[4]  = next_even<0x02>(keys[2], keys[3]);
+    keys[5]  = next_odd(keys[3], keys[4]);
+    keys[6]  = next_even<0x04>(keys[4], keys[5]);
+    keys[7]  = next_odd(keys[5], keys[6]);
+    keys[8]  = next_even<0x08>(keys[6], keys[7]);
+    keys[9]  = next_odd(keys[7], keys[8]);
+    keys[10] = next_even<0x10>(keys[8], keys[9]);
+    keys[11] = next_odd(keys[9], keys[10]);
+    keys[12] = next_even<0x20>(keys[10], keys[11]);
+    keys[13] = next_odd(keys[11], keys[12]);
+    keys[14] = next_even<0x40>(keys[12], keys[13]);
+}
+
+INLINE void expand_decrypt(keys128& keys, const secret& key) NOEXCEPT
+{
+    // Equivalent inverse cipher: reversed schedule, inner keys inverse mixed.
+    keys128 forward{};
+    expand_encrypt(forward, key);
+
+    keys.front() = forward.back();
+    keys.back() = forward.front();
+    for (size_t round = 1; round < rounds; ++round)
+        keys[round] = aes_inverse_mix(forward[rounds - round]);
+}
+
+template <typename xWord, size_t Lanes>
+INLINE void encrypt_lanes(xlanes<xWord, Lanes>& lanes,
+    const xkeys<xWord>& keys) NOEXCEPT
+{
+    for (auto& lane: lanes)
+        lane = f::xor_(lane, keys.front());
+
+    for (size_t round = 1; round < rounds; ++round)
+        for (auto& lane: lanes)
+            lane = aes_encrypt(lane, keys[round]);
+
+    for (auto& lane: lanes)
+        lane = aes_encrypt_last(lane, keys.back());
+}
+
+template <typename xWord, size_t Lanes>
+INLINE void decrypt_lanes(xlanes<xWord, Lanes>& lanes,
+    const xkeys<xWord>& keys) NOEXCEPT
+{
+    for (auto& lane: lanes)
+        lane = f::xor_(lane, keys.front());
+
+    for (size_t round = 1; round < rounds; ++round)
+        for (auto& lane: lanes)
+            lane = aes_decrypt(lane, keys[round]);
+
+    for (auto& lane: lanes)
+        lane = aes_decrypt_last(lane, keys.back());
+}
+
+template <bool Encrypt, typename xWord, size_t Lanes>
+INLINE void ecb_lanes(const data_slab& bytes, size_t& offset,
+    const xkeys<xWord>& keys) NOEXCEPT
+{
+    constexpr auto size = Lanes * sizeof(xWord);
+
+    xlanes<xWord, Lanes> lanes{};
+    for (; (bytes.size() - offset) >= size; offset += size)
+    {
+        for (size_t lane = 0; lane < Lanes; ++lane)
+            lanes[lane] = load_at<xWord>(bytes, offset + lane * sizeof(xWord));
+
+        if constexpr (Encrypt)
+            encrypt_lanes(lanes, keys);
+        else
+            decrypt_lanes(lanes, keys);
+
+        for (size_t lane = 0; lane < Lanes; ++lane)
+            store_at(bytes, offset + lane * sizeof(xWord), lanes[lane]);
+    }
+}
+
+template <typename xWord, size_t Lanes>
+INLINE void ctr_lanes(const data_slab& bytes, size_t& offset, block& counter,
+    const xkeys<xWord>& keys) NOEXCEPT
+{
+    constexpr auto blocks = sizeof(xWord) / block_size;
+    constexpr auto size = Lanes * sizeof(xWord);
+
+    xlanes<xWord, Lanes> lanes{};
+    std_array<uint8_t, sizeof(xWord)> counters{};
+    for (; (bytes.size() - offset) >= size; offset += size)
+    {
+        for (auto& lane: lanes)
+        {
+            for (size_t index = 0; index < blocks; ++index)
+            {
+                unsafe_array_cast<uint8_t, block_size>(std::next(
+                    counters.data(), index * block_size)) = counter;
+                increment(counter);
+            }
+
+            lane = load(counters);
+        }
+
+        encrypt_lanes(lanes, keys);
+
+        for (size_t lane = 0; lane < Lanes; ++lane)
+        {
+            const auto at = offset + lane * sizeof(xWord);
+            store_at(bytes, at, f::xor_(load_at<xWord>(bytes, at), lanes[lane]));
+        }
+    }
+}
+
+template <size_t Lanes>
+INLINE void cbc_lanes(const data_slab& bytes, size_t& offset,
+    xint128_t& prior, const keys128& keys) NOEXCEPT
+{
+    constexpr auto size = Lanes * block_size;
+
+    xlanes<xint128_t, Lanes> lanes{};
+    xlanes<xint128_t, Lanes> cipher{};
+    for (; (bytes.size() - offset) >= size; offset += size)
+    {
+        for (size_t lane = 0; lane < Lanes; ++lane)
+            lanes[lane] = cipher[lane] = load_at<xint128_t>(bytes,
+                offset + lane * block_size);
+
+        decrypt_lanes(lanes, keys);
+
+        for (size_t lane = 0; lane < Lanes; ++lane)
+        {
+            store_at(bytes, offset + lane * block_size,
+                f::xor_(lanes[lane], prior));
+            prior = cipher[lane];
+        }
+    }
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+#if defined(HAVE_VAES)
+INLINE xkeys<xint512_t> broadcast_keys(const keys128& keys) NOEXCEPT
+{
+    xkeys<xint512_t> wide{};
+    for (size_t round = 0; round < keys.size(); ++round)
+        wide.at(round) = aes_broadcast(keys.at(round));
+
+    return wide;
+}
+#endif
+
+template <bool Encrypt>
+void ecb_native(const data_slab& bytes, const secret& key) NOEXCEPT
+{
+    keys128 keys{};
+    if constexpr (Encrypt)
+        expand_encrypt(keys, key);
+    else
+        expand_decrypt(keys, key);
+
+    size_t offset{};
+
+#if defined(HAVE_VAES)
+    // Four blocks per lane.
+    if (have_vaes())
+        ecb_lanes<Encrypt, xint512_t, pipeline / 2>(bytes, offset,
+            broadcast_keys(keys));
+#endif
+
+    ecb_lanes<Encrypt, xint128_t, pipeline>(bytes, offset, keys);
+    ecb_lanes<Encrypt, xint128_t, one>(bytes, offset, keys);
+}
+
+void encrypt_cbc_native(const data_slab& bytes, const secret& key,
+    const block& iv) NOEXCEPT
+{
+    keys128 keys{};
+    expand_encrypt(keys, key);
+
+    // Each block depends on the prior cipher text, so cannot be pipelined.
+    xlanes<xint128_t, one> lane{ load(iv) };
+    for (size_t offset{}; offset < bytes.size(); offset += block_size)
+    {
+        lane.front() = f::xor_(lane.front(), load_at<xint128_t>(bytes, offset));
+        encrypt_lanes(lane, keys);
+        store_at(bytes, offset, lane.front());
+    }
+}
+
+void decrypt_cbc_native(const data_slab& bytes, const secret& key,
+    const block& iv) NOEXCEPT
+{
+    keys128 keys{};
+    expand_decrypt(keys, key);
+
+    size_t offset{};
+    auto prior = load(iv);
+    cbc_lanes<pipeline>(bytes, offset, prior, keys);
+    cbc_lanes<one>(bytes, offset, prior, keys);
+}
+
+void ctr_native(const data_slab& bytes, const secret& key,
+    const block& counter) NOEXCEPT
+{
+    keys128 keys{};
+    expand_encrypt(keys, key);
+
+    size_t offset{};
+    auto count = counter;
+
+#if defined(HAVE_VAES)
+    // Four blocks per lane.
+    if (have_vaes())
+        ctr_lanes<xint512_t, pipeline / 2>(bytes, offset, count,
+            broadcast_keys(keys));
+#endif
+
+    ctr_lanes<xint128_t, pipeline>(bytes, offset, count, keys);
+    ctr_lanes<xint128_t, one>(bytes, offset, count, keys);
+
+    // Partial final block.
+    if (offset < bytes.size())
+    {
+        block stream{};
+        xlanes<xint128_t, one> lane{ load(count) };
+        encrypt_lanes(lane, keys);
+        store(stream, lane.front());
+        xor_stream(bytes, offset, stream);
+    }
+}
+
+#endif // HAVE_AESNI
+
 // published
 // ----------------------------------------------------------------------------
 
 void encrypt(block& bytes, const secret& key) NOEXCEPT
 {
+#if defined(HAVE_AESNI)
+    if (have_aesni())
+    {
+        ecb_native<true>(bytes, key);
+        return;
+    }
+#endif
+
     aes256::context context;
     initialize(context, key);
     encrypt_block(context, bytes);
@@ -403,12 +830,110 @@ void encrypt(block& bytes, const secret& key) NOEXCEPT
 
 void decrypt(block& bytes, const secret& key) NOEXCEPT
 {
+#if defined(HAVE_AESNI)
+    if (have_aesni())
+    {
+        ecb_native<false>(bytes, key);
+        return;
+    }
+#endif
+
     aes256::context context;
     initialize(context, key);
     decrypt_block(context, bytes);
     ////zeroize(context);
 }
 
+bool encrypt_ecb(const data_slab& bytes, const secret& key) NOEXCEPT
+{
+    if (!is_zero(bytes.size() % block_size))
+        return false;
+
+#if defined(HAVE_AESNI)
+    if (have_aesni())
+    {
+        ecb_native<true>(bytes, key);
+        return true;
+    }
+#endif
+
+    ecb_portable<true>(bytes, key);
+    return true;
+}
+
+bool decrypt_ecb(const data_slab& bytes, const secret& key) NOEXCEPT
+{
+    if (!is_zero(bytes.size() % block_size))
+        return false;
+
+#if defined(HAVE_AESNI)
+    if (have_aesni())
+    {
+        ecb_native<false>(bytes, key);
+        return true;
+    }
+#endif
+
+    ecb_portable<false>(bytes, key);
+    return true;
+}
+
+bool encrypt_cbc(const data_slab& bytes, const secret& key,
+    const block& iv) NOEXCEPT
+{
+    if (!is_zero(bytes.size() % block_size))
+        return false;
+
+#if defined(HAVE_AESNI)
+    if (have_aesni())
+    {
+        encrypt_cbc_native(bytes, key, iv);
+        return true;
+    }
+#endif
+
+    encrypt_cbc_portable(bytes, key, iv);
+    return true;
+}
+
+bool decrypt_cbc(const data_slab& bytes, const secret& key,
+    const block& iv) NOEXCEPT
+{
+    if (!is_zero(bytes.size() % block_size))
+        return false;
+
+#if defined(HAVE_AESNI)
+    if (have_aesni())
+    {
+        decrypt_cbc_native(bytes, key, iv);
+        return true;
+    }
+#endif
+
+    decrypt_cbc_portable(bytes, key, iv);
+    return true;
+}
+
+void encrypt_ctr(const data_slab& bytes, const secret& key,
+    const block& counter) NOEXCEPT
+{
+#if defined(HAVE_AESNI)
+    if (have_aesni())
+    {
+        ctr_native(bytes, key, counter);
+        return;
+    }
+#endif
+
+    ctr_portable(bytes, key, counter);
+}
+
+void decrypt_ctr(const data_slab& bytes, const secret& key,
+    const block& counter) NOEXCEPT
+{
+    encrypt_ctr(bytes, key, counter);
+}
+
 } // namespace aes256
 } // namespace system
 } // namespace libbitcoin
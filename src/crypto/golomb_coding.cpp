@@ -72,14 +72,15 @@ static std::vector<uint64_t> hashed_set_construct(const data_stack& items,
     const auto bound = target_false_positive_rate * set_size;
     std::vector<uint64_t> hashes(items.size());
 
-    // C++17: parallel policy for std::transform.
-    std::transform(items.begin(), items.end(), hashes.begin(),
+    // Items are hashed independently, then sorted, both in parallel.
+    std_transform(bc::par_unseq, items.begin(), items.end(), hashes.begin(),
         [&](const data_chunk& item) NOEXCEPT
         {
             return hash_to_range(item, bound, key);
         });
 
-    return sort(std::move(hashes));
+    std_sort(bc::par_unseq, hashes.begin(), hashes.end());
+    return hashes;
 }
 
 // Golomb-coded set construction
@@ -259,6 +260,107 @@ bool match(const data_stack& targets, std::istream& compressed_set,
         target_false_positive_rate);
 }
 
+// Decoded set
+// ----------------------------------------------------------------------------
+
+static bool decode(decoded_set& out, bitreader& compressed_set,
+    uint64_t set_size, uint8_t bits) NOEXCEPT
+{
+    uint64_t value = 0;
+    for (uint64_t index = 0; index < set_size; index++)
+    {
+        value += decode(compressed_set, bits);
+        if (!compressed_set)
+            return false;
+
+        out.push_back(value);
+    }
+
+    return true;
+}
+
+decoded_set decode(const data_chunk& compressed_set, uint64_t set_size,
+    uint8_t bits) NOEXCEPT
+{
+    // Each value is encoded in at least (bits + 1) bits, which bounds the
+    // allocation against an arbitrary set_size.
+    const auto limit = to_bits(compressed_set.size()) / add1<size_t>(bits);
+
+    decoded_set set{};
+    set.reserve(std::min(limit, possible_narrow_cast<size_t>(set_size)));
+    stream::in::copy source(compressed_set);
+    read::bits::istream reader(source);
+
+    if (!decode(set, reader, set_size, bits))
+        return {};
+
+    return set;
+}
+
+decoded_set decode(std::istream& compressed_set, uint64_t set_size,
+    uint8_t bits) NOEXCEPT
+{
+    decoded_set set{};
+    read::bits::istream reader(compressed_set);
+
+    if (!decode(set, reader, set_size, bits))
+        return {};
+
+    return set;
+}
+
+bool match(const data_chunk& target, const decoded_set& set,
+    const half_hash& entropy, uint64_t target_false_positive_rate) NOEXCEPT
+{
+    return match(target, set, to_siphash_key(entropy),
+        target_false_positive_rate);
+}
+
+bool match(const data_chunk& target, const decoded_set& set,
+    const siphash_key& entropy, uint64_t target_false_positive_rate) NOEXCEPT
+{
+    const auto set_size = set.size();
+    if (is_multiply_overflow<uint64_t>(target_false_positive_rate, set_size))
+        return false;
+
+    const auto bound = target_false_positive_rate * set_size;
+    const auto range = hash_to_range(target, bound, entropy);
+    return std::binary_search(set.begin(), set.end(), range);
+}
+
+bool match(const data_stack& targets, const decoded_set& set,
+    const half_hash& entropy, uint64_t target_false_positive_rate) NOEXCEPT
+{
+    return match(targets, set, to_siphash_key(entropy),
+        target_false_positive_rate);
+}
+
+bool match(const data_stack& targets, const decoded_set& set,
+    const siphash_key& entropy, uint64_t target_false_positive_rate) NOEXCEPT
+{
+    if (targets.empty())
+        return false;
+
+    const auto hashes = hashed_set_construct(targets, set.size(),
+        target_false_positive_rate, entropy);
+
+    // Both sets are sorted, so intersect by merge.
+    auto value = set.begin();
+    auto hash = hashes.begin();
+    while (value != set.end() && hash != hashes.end())
+    {
+        if (*hash == *value)
+            return true;
+
+        if (*hash < *value)
+            ++hash;
+        else
+            ++value;
+    }
+
+    return false;
+}
+
 } // namespace golomb
 } // namespace system
 } // namespace libbitcoin
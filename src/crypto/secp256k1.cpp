@@ -19,10 +19,16 @@
 #include <bitcoin/system/crypto/secp256k1.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <utility>
 #include <secp256k1.h>
+#include <secp256k1_extrakeys.h>
 #include <secp256k1_recovery.h>
+#include <secp256k1_schnorrsig.h>
 #include <bitcoin/system/crypto/der_parser.hpp>
+#include <bitcoin/system/crypto/signature_cache.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/math/math.hpp>
@@ -61,6 +67,17 @@ bool parse(const secp256k1_context* context, secp256k1_pubkey& out,
         == ec_success;
 }
 
+bool parse(const secp256k1_context* context, secp256k1_xonly_pubkey& out,
+    const data_slice& point) NOEXCEPT
+{
+    if (point.size() != ec_xonly_size)
+        return false;
+
+    // secp256k1_xonly_pubkey_parse rejects an x coordinate not on the curve.
+    return secp256k1_xonly_pubkey_parse(context, &out, point.data())
+        == ec_success;
+}
+
 bool parse(const secp256k1_context* context, std::vector<secp256k1_pubkey>& out,
     const compressed_list& points) NOEXCEPT
 {
@@ -175,6 +192,15 @@ bool verify_signature(const secp256k1_context* context,
         ec_success;
 }
 
+// parsed - verify
+bool verify_schnorr(const secp256k1_context* context,
+    const secp256k1_xonly_pubkey& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+    return secp256k1_schnorrsig_verify(context, signature.data(), hash.data(),
+        hash_size, &point) == ec_success;
+}
+
 // Add EC values
 // ----------------------------------------------------------------------------
 
@@ -190,6 +216,34 @@ bool ec_add(ec_uncompressed& point, const ec_secret& scalar) NOEXCEPT
     return ec_add(context, point, scalar);
 }
 
+// parse (once), add, serialize
+bool ec_add(compressed_list& out, const ec_compressed& point,
+    const secret_list& scalars) NOEXCEPT
+{
+    out.clear();
+    const auto context = ec_context_verify::context();
+
+    secp256k1_pubkey parent;
+    if (!parse(context, parent, point))
+        return false;
+
+    out.resize(scalars.size());
+    auto sum = out.begin();
+
+    for (const auto& scalar: scalars)
+    {
+        auto pubkey = parent;
+        if (secp256k1_ec_pubkey_tweak_add(context, &pubkey, scalar.data()) !=
+            ec_success || !serialize(context, *sum++, pubkey))
+        {
+            out.clear();
+            return false;
+        }
+    }
+
+    return true;
+}
+
 // secrets are normal
 bool ec_add(ec_secret& left, const ec_secret& right) NOEXCEPT
 {
@@ -431,15 +485,182 @@ bool sign(ec_signature& out, const ec_secret& secret,
         secp256k1_nonce_function_rfc6979, nullptr) == ec_success);
 }
 
+// Process-wide verification cache, null until enabled (once).
+static std::once_flag cache_once_{};
+static std::unique_ptr<signature_cache> cache_{};
+static std::atomic<signature_cache*> verified_{};
+
+void set_signature_cache(size_t capacity) NOEXCEPT
+{
+    if (is_zero(capacity))
+        return;
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::call_once(cache_once_, [capacity]() NOEXCEPT
+    {
+        cache_ = std::make_unique<signature_cache>(capacity);
+        verified_.store(cache_.get(), std::memory_order_release);
+    });
+    BC_POP_WARNING()
+}
+
+static signature_cache* verified() NOEXCEPT
+{
+    return verified_.load(std::memory_order_acquire);
+}
+
 // parse<>, verify<>
 bool verify_signature(const data_slice& point, const hash_digest& hash,
     const ec_signature& signature) NOEXCEPT
 {
+    constexpr auto kind = signature_kind::ecdsa;
+    const auto cache = verified();
+    if (cache && cache->contains(point, hash, signature, kind))
+        return true;
+
+    secp256k1_pubkey pubkey;
+    const auto context = ec_context_verify::context();
+
+    if (!parse(context, pubkey, point) ||
+        !verify_signature(context, pubkey, hash, signature))
+        return false;
+
+    if (cache)
+        cache->insert(point, hash, signature, kind);
+
+    return true;
+}
+
+// Deferred, not batch, verification: libsecp256k1 exposes no batch
+// (multi-scalar) verification, so each entry is verified individually. This
+// only amortizes context acquisition, and key parsing across consecutive
+// entries that share a point (multisig, address reuse).
+size_t verify_signatures(const signature_batch& batch) NOEXCEPT
+{
+    secp256k1_pubkey pubkey;
+    secp256k1_xonly_pubkey xonly;
+    const signature_entry* parsed{};
+    const auto cache = verified();
+    const auto context = ec_context_verify::context();
+
+    for (size_t index = 0; index < batch.size(); ++index)
+    {
+        const auto& entry = batch[index];
+
+        if (cache && cache->contains(entry.point, entry.hash,
+            entry.signature, entry.kind))
+            continue;
+
+        // The last parsed key is reused only for the same point and scheme.
+        const auto schnorr = (entry.kind == signature_kind::schnorr);
+
+        if (is_null(parsed) || parsed->kind != entry.kind ||
+            parsed->point != entry.point)
+        {
+            if (schnorr ? !parse(context, xonly, entry.point) :
+                !parse(context, pubkey, entry.point))
+                return index;
+
+            parsed = &entry;
+        }
+
+        if (schnorr ?
+            !verify_schnorr(context, xonly, entry.hash, entry.signature) :
+            !verify_signature(context, pubkey, entry.hash, entry.signature))
+            return index;
+
+        if (cache)
+            cache->insert(entry.point, entry.hash, entry.signature,
+                entry.kind);
+    }
+
+    return batch.size();
+}
+
+// Schnorr sign/verify (bip340)
+// ----------------------------------------------------------------------------
+
+// create, serialize (secrets are normal)
+bool secret_to_xonly(ec_xonly& out, const ec_secret& secret) NOEXCEPT
+{
+    secp256k1_keypair keypair;
+    secp256k1_xonly_pubkey xonly;
+    const auto context = ec_context_sign::context();
+    return
+        secp256k1_keypair_create(context, &keypair, secret.data()) ==
+            ec_success &&
+        secp256k1_keypair_xonly_pub(context, &xonly, nullptr, &keypair) ==
+            ec_success &&
+        secp256k1_xonly_pubkey_serialize(context, out.data(), &xonly) ==
+            ec_success;
+}
+
+// create, sign (secrets are normal)
+bool sign_schnorr(ec_signature& out, const ec_secret& secret,
+    const hash_digest& hash, const hash_digest& auxiliary) NOEXCEPT
+{
+    secp256k1_keypair keypair;
+    const auto context = ec_context_sign::context();
+    return
+        secp256k1_keypair_create(context, &keypair, secret.data()) ==
+            ec_success &&
+        secp256k1_schnorrsig_sign32(context, out.data(), hash.data(),
+            &keypair, auxiliary.data()) == ec_success;
+}
+
+// parse<>, verify<>
+bool verify_schnorr(const data_slice& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+    constexpr auto kind = signature_kind::schnorr;
+    const auto cache = verified();
+    if (cache && cache->contains(point, hash, signature, kind))
+        return true;
+
+    secp256k1_xonly_pubkey xonly;
+    const auto context = ec_context_verify::context();
+
+    if (!parse(context, xonly, point) ||
+        !verify_schnorr(context, xonly, hash, signature))
+        return false;
+
+    if (cache)
+        cache->insert(point, hash, signature, kind);
+
+    return true;
+}
+
+// parse, tweak, serialize
+bool tweak_xonly(ec_xonly& out, bool& odd, const ec_xonly& point,
+    const hash_digest& tweak) NOEXCEPT
+{
+    auto parity = 0;
     secp256k1_pubkey pubkey;
+    secp256k1_xonly_pubkey xonly;
     const auto context = ec_context_verify::context();
 
-    return parse(context, pubkey, point) &&
-        verify_signature(context, pubkey, hash, signature);
+    if (!parse(context, xonly, point) ||
+        secp256k1_xonly_pubkey_tweak_add(context, &pubkey, &xonly,
+            tweak.data()) != ec_success ||
+        secp256k1_xonly_pubkey_from_pubkey(context, &xonly, &parity,
+            &pubkey) != ec_success ||
+        secp256k1_xonly_pubkey_serialize(context, out.data(), &xonly) !=
+            ec_success)
+        return false;
+
+    odd = to_bool(parity);
+    return true;
+}
+
+// parse, check
+bool verify_tweak(const ec_xonly& tweaked, bool odd, const ec_xonly& point,
+    const hash_digest& tweak) NOEXCEPT
+{
+    secp256k1_xonly_pubkey xonly;
+    const auto context = ec_context_verify::context();
+    return parse(context, xonly, point) &&
+        secp256k1_xonly_pubkey_tweak_add_check(context, tweaked.data(),
+            to_int<int>(odd), &xonly, tweak.data()) == ec_success;
 }
 
 // Recoverable sign/recover
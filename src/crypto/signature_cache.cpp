@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/crypto/signature_cache.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <bitcoin/system/crypto/pseudo_random.hpp>
+#include <bitcoin/system/crypto/secp256k1.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+static hash_digest new_salt() NOEXCEPT
+{
+    hash_digest salt{};
+    pseudo_random::fill(salt);
+    return salt;
+}
+
+signature_cache::signature_cache(size_t capacity) NOEXCEPT
+  : buckets_(capacity / (shards * ways)),
+    salt_(new_salt())
+{
+    for (auto& shard: shards_)
+        shard.slots.resize(buckets_ * ways, null_hash);
+}
+
+bool signature_cache::contains(const data_slice& point,
+    const hash_digest& hash, const ec_signature& signature,
+    signature_kind kind) const NOEXCEPT
+{
+    if (is_zero(buckets_))
+        return false;
+
+    const auto key = digest(point, hash, signature, kind);
+    const auto& shard = shard_at(key);
+    const auto first = std::next(shard.slots.begin(), bucket(key) * ways);
+    const auto last = std::next(first, ways);
+
+    std::lock_guard lock{ shard.mutex };
+    return std::find(first, last, key) != last;
+}
+
+void signature_cache::insert(const data_slice& point, const hash_digest& hash,
+    const ec_signature& signature, signature_kind kind) NOEXCEPT
+{
+    if (is_zero(buckets_))
+        return;
+
+    const auto key = digest(point, hash, signature, kind);
+    auto& shard = shard_at(key);
+    const auto first = std::next(shard.slots.begin(), bucket(key) * ways);
+    const auto last = std::next(first, ways);
+
+    std::lock_guard lock{ shard.mutex };
+    if (std::find(first, last, key) != last)
+        return;
+
+    // Fill an empty way, otherwise rotate replacement across the shard.
+    const auto empty = std::find(first, last, null_hash);
+    if (empty != last)
+    {
+        *empty = key;
+        return;
+    }
+
+    *std::next(first, shard.rotation++ % ways) = key;
+}
+
+size_t signature_cache::capacity() const NOEXCEPT
+{
+    return buckets_ * ways * shards;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+hash_digest signature_cache::digest(const data_slice& point,
+    const hash_digest& hash, const ec_signature& signature,
+    signature_kind kind) const NOEXCEPT
+{
+    hash_digest out;
+    hash::sha256::copy sink(out);
+    sink.write_bytes(salt_);
+    sink.write_byte(static_cast<uint8_t>(kind));
+    sink.write_bytes(hash);
+    sink.write_bytes(signature);
+    sink.write_bytes(point);
+    sink.flush();
+    return out;
+}
+
+// The digest is uniformly distributed, so its low bits select the shard and
+// the remaining bits of the low word select the bucket within the shard.
+const signature_cache::shard& signature_cache::shard_at(
+    const hash_digest& digest) const NOEXCEPT
+{
+    return shards_.at(unique_hash(digest) % shards);
+}
+
+signature_cache::shard& signature_cache::shard_at(
+    const hash_digest& digest) NOEXCEPT
+{
+    return shards_.at(unique_hash(digest) % shards);
+}
+
+size_t signature_cache::bucket(const hash_digest& digest) const NOEXCEPT
+{
+    return (unique_hash(digest) / shards) % buckets_;
+}
+
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
@@ -153,6 +153,12 @@ DEFINED("HAVE_AVX512")
 #ifdef HAVE_SHANI
 DEFINED("HAVE_SHANI")
 #endif
+#ifdef HAVE_AESNI
+DEFINED("HAVE_AESNI")
+#endif
+#ifdef HAVE_VAES
+DEFINED("HAVE_VAES")
+#endif
 
 #ifdef HAVE_VS2013
 DEFINED("HAVE_VS2013")
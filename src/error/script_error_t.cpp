@@ -42,6 +42,8 @@ DEFINE_ERROR_T_MESSAGE_MAP(script_error)
     { invalid_witness, "invalid witness" },
     { invalid_witness_stack, "invalid witness stack" },
     { dirty_witness, "dirty witness" },
+    { invalid_taproot_signature, "invalid taproot signature" },
+    { unsupported_taproot_script, "unsupported taproot script path" },
     { stack_false, "stack false" }
 };
 
@@ -19,23 +19,55 @@
 #include <bitcoin/system/radix/base_58.hpp>
 
 #include <algorithm>
+#include <array>
+#include <vector>
 #include <bitcoin/system/define.hpp>
 
 // base58
 // Base 58 is an ascii data encoding with a domain of 58 symbols (characters).
 // 58 is not a power of 2 so base58 is not a bit mapping.
 
+// Conversion is over limbs, each holding five base58 digits (58^5 < 2^30) or
+// four bytes (2^32), accumulated in 64 bits. This processes four bytes or five
+// digits per limb pass, in place of one byte or digit per (digit) pass. Limbs
+// are on the stack for up to 169 bytes or 260 digits (all keys and addresses).
+
 namespace libbitcoin {
 namespace system {
 
-const std::string base58_chars =
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+constexpr char base58_chars[] =
     "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
 
+constexpr uint8_t base58_invalid = 0xff;
+constexpr uint64_t base58_limb = 58u * 58u * 58u * 58u * 58u;
+constexpr size_t limb_digits = 5;
+constexpr size_t limb_bytes = sizeof(uint32_t);
+constexpr size_t stack_limbs = 48;
+
+// Character to digit value, base58_invalid if not a base58 character.
+constexpr auto base58_values = []() NOEXCEPT
+{
+    std::array<uint8_t, 256> values{};
+    values.fill(base58_invalid);
+    for (uint8_t digit = 0; digit < 58u; ++digit)
+        values[static_cast<uint8_t>(base58_chars[digit])] = digit;
+
+    return values;
+}();
+
+constexpr uint8_t to_digit(char character) NOEXCEPT
+{
+    return base58_values[static_cast<uint8_t>(character)];
+}
+
 bool is_base58(char character) NOEXCEPT
 {
-    // The base58 character list is lexically sorted.
-    return std::binary_search(base58_chars.begin(), base58_chars.end(),
-        character);
+    return to_digit(character) != base58_invalid;
 }
 
 bool is_base58(const std::string& text) NOEXCEPT
@@ -48,20 +80,27 @@ bool is_base58(const std::string& text) NOEXCEPT
     return std::all_of(text.begin(), text.end(), test);
 }
 
-template <typename Data>
-static auto find_first_nonzero(const Data& data) NOEXCEPT ->
-    decltype(data.cbegin())
+// Invoke function with a limb buffer of count, on the stack if sufficient.
+template <typename Function>
+static auto with_limbs(size_t count, Function&& function) NOEXCEPT
 {
-    auto first_nonzero = data.cbegin();
-    while (first_nonzero != data.end() && is_zero(*first_nonzero))
-        ++first_nonzero;
+    if (count <= stack_limbs)
+    {
+        BC_PUSH_WARNING(LOCAL_VARIABLE_NOT_INITIALIZED)
+        std::array<uint64_t, stack_limbs> limbs;
+        BC_POP_WARNING()
+        return function(limbs.data());
+    }
 
-    return first_nonzero;
+    std::vector<uint64_t> limbs(count);
+    return function(limbs.data());
 }
 
-size_t count_leading_zeros(const data_slice& unencoded) NOEXCEPT
+// encode
+// ----------------------------------------------------------------------------
+
+static size_t count_leading_zeros(const data_slice& unencoded) NOEXCEPT
 {
-    // Skip and count leading '1's.
     size_t leading_zeros = 0;
     for (const auto byte: unencoded)
     {
@@ -74,68 +113,98 @@ size_t count_leading_zeros(const data_slice& unencoded) NOEXCEPT
     return leading_zeros;
 }
 
-void pack_value(data_chunk& indexes, size_t carry) NOEXCEPT
+// Big-endian bytes to little-endian limbs of 58^5, returns limb count.
+static size_t to_digit_limbs(uint64_t* limbs, const uint8_t* data,
+    size_t size) NOEXCEPT
 {
-    // Apply "b58 = b58 * 256 + ch".
-    for (auto it = indexes.rbegin(); it != indexes.rend(); ++it)
+    auto count = zero;
+    auto chunk = is_zero(size % limb_bytes) ? limb_bytes : size % limb_bytes;
+
+    for (size_t offset = 0; offset < size; offset += chunk, chunk = limb_bytes)
     {
-        carry += 256_size * (*it);
-        *it = carry % 58_size;
-        carry /= 58_size;
+        uint64_t carry = 0;
+        for (size_t byte = 0; byte < chunk; ++byte)
+            carry = (carry << byte_bits) | data[offset + byte];
+
+        // Apply "b58 = b58 * 256^chunk + chunk value".
+        const auto shift = chunk * byte_bits;
+        for (size_t limb = 0; limb < count; ++limb)
+        {
+            carry += limbs[limb] << shift;
+            limbs[limb] = carry % base58_limb;
+            carry /= base58_limb;
+        }
+
+        for (; !is_zero(carry); carry /= base58_limb)
+            limbs[count++] = carry % base58_limb;
     }
 
-    BC_ASSERT(is_zero(carry));
+    return count;
 }
 
-std::string encode_base58(const data_slice& unencoded) NOEXCEPT
+static size_t top_digits(uint64_t limb) NOEXCEPT
+{
+    auto digits = zero;
+    for (; !is_zero(limb); limb /= 58u)
+        ++digits;
+
+    return digits;
+}
+
+size_t encode_base58(char* out, size_t size,
+    const data_slice& unencoded) NOEXCEPT
 {
     const auto leading_zeros = count_leading_zeros(unencoded);
+    const auto number = unencoded.size() - leading_zeros;
+    const auto limbs_size = add1(number * 28_size / 100_size);
 
-    // size = log(256) / log(58), rounded up.
-    const auto number_nonzero = unencoded.size() - leading_zeros;
-    const auto indexes_size = add1(number_nonzero * 138_size / 100_size);
+    return with_limbs(limbs_size, [&](uint64_t* limbs) NOEXCEPT
+    {
+        const auto count = to_digit_limbs(limbs,
+            std::next(unencoded.data(), leading_zeros), number);
 
-    // Allocate enough space in big-endian base58 representation.
-    data_chunk indexes(indexes_size, 0x00);
+        const auto high = is_zero(count) ? zero : top_digits(limbs[sub1(count)]);
+        const auto digits = is_zero(count) ? zero :
+            high + sub1(count) * limb_digits;
+        const auto length = leading_zeros + digits;
 
-    // Process the bytes.
-    for (size_t index = leading_zeros; index < unencoded.size(); ++index)
-        pack_value(indexes, unencoded[index]);
+        if (length > size)
+            return zero;
 
-    // Skip leading zeros in base58 result.
-    auto it = find_first_nonzero(indexes);
+        std::fill_n(out, leading_zeros, base58_chars[0]);
 
-    // Translate the result into a string.
-    std::string encoded;
-    const size_t estimated_size = leading_zeros + (indexes.end() - it);
-    encoded.reserve(estimated_size);
-    encoded.assign(leading_zeros, '1');
+        // Limbs are written high to low, each filled from its low digit.
+        auto end = std::next(out, length);
+        for (size_t limb = 0; limb < count; ++limb)
+        {
+            auto value = limbs[limb];
+            const auto width = limb == sub1(count) ? high : limb_digits;
+            for (size_t digit = 0; digit < width; ++digit, value /= 58u)
+                *(--end) = base58_chars[value % 58u];
+        }
 
-    // Set actual main bytes.
-    for (; it != indexes.end(); ++it)
-    {
-        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
-        BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
-        encoded += base58_chars[*it];
-        BC_POP_WARNING()
-        BC_POP_WARNING()
-    }
+        return length;
+    });
+}
 
+std::string encode_base58(const data_slice& unencoded) NOEXCEPT
+{
+    std::string encoded(base58_size(unencoded.size()), base58_chars[0]);
+    encoded.resize(encode_base58(encoded.data(), encoded.size(), unencoded));
     return encoded;
 }
 
-size_t count_leading_zeros(const std::string& encoded) NOEXCEPT
+// decode
+// ----------------------------------------------------------------------------
+
+static size_t count_leading_zeros(const std::string& encoded) NOEXCEPT
 {
     // Skip and count leading '1's.
-    auto leading_zeros = zero;
+    size_t leading_zeros = 0;
     for (const auto digit: encoded)
     {
-        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
         if (digit != base58_chars[0])
-        BC_POP_WARNING()
-        {
             break;
-        }
 
         ++leading_zeros;
     }
@@ -143,51 +212,115 @@ size_t count_leading_zeros(const std::string& encoded) NOEXCEPT
     return leading_zeros;
 }
 
-void unpack_char(data_chunk& data, size_t carry) NOEXCEPT
+// Base58 characters to little-endian limbs of 2^32, false if invalid.
+static bool to_byte_limbs(uint64_t* limbs, size_t& count, const char* text,
+    size_t size) NOEXCEPT
 {
-    for (auto it = data.rbegin(); it != data.rend(); it++)
+    count = zero;
+    auto chunk = is_zero(size % limb_digits) ? limb_digits : size % limb_digits;
+
+    for (size_t offset = 0; offset < size; offset += chunk, chunk = limb_digits)
     {
-        carry += 58_size * (*it);
-        *it = carry % 256_size;
-        carry /= 256_size;
+        uint64_t carry = 0;
+        uint64_t factor = 1;
+        for (size_t digit = 0; digit < chunk; ++digit)
+        {
+            const auto value = to_digit(text[offset + digit]);
+            if (value == base58_invalid)
+                return false;
+
+            carry = carry * 58u + value;
+            factor *= 58u;
+        }
+
+        // Apply "b256 = b256 * 58^chunk + chunk value".
+        for (size_t limb = 0; limb < count; ++limb)
+        {
+            carry += limbs[limb] * factor;
+            limbs[limb] = carry & max_uint32;
+            carry >>= to_bits(limb_bytes);
+        }
+
+        for (; !is_zero(carry); carry >>= to_bits(limb_bytes))
+            limbs[count++] = carry & max_uint32;
     }
 
-    BC_ASSERT(is_zero(carry));
+    return true;
 }
 
-bool decode_base58(data_chunk& out, const std::string& in) NOEXCEPT
+static size_t top_bytes(uint64_t limb) NOEXCEPT
 {
-    out.clear();
+    auto bytes = zero;
+    for (; !is_zero(limb); limb >>= byte_bits)
+        ++bytes;
 
-    // Trim spaces and newlines around the string.
+    return bytes;
+}
+
+// Decodes to the buffer obtained from allocate(size, out).
+// False if invalid or if allocate returns false (nothing written).
+template <typename Allocate>
+static bool decode(const std::string& in, Allocate&& allocate) NOEXCEPT
+{
     const auto leading_zeros = count_leading_zeros(in);
+    const auto number = in.size() - leading_zeros;
+    const auto limbs_size = add1(number * 184_size / 1000_size);
 
-    // log(58) / log(256), rounded up.
-    const size_t data_size = add1(in.size() * 733_size / 1000_size);
+    return with_limbs(limbs_size, [&](uint64_t* limbs) NOEXCEPT
+    {
+        size_t count{};
+        if (!to_byte_limbs(limbs, count, std::next(in.data(), leading_zeros),
+            number))
+            return false;
 
-    // Allocate enough space in big-endian base256 representation.
-    data_chunk data(data_size, 0x00);
+        const auto high = is_zero(count) ? zero : top_bytes(limbs[sub1(count)]);
+        const auto bytes = is_zero(count) ? zero :
+            high + sub1(count) * limb_bytes;
 
-    // Process the characters.
-    for (auto it = in.begin() + leading_zeros; it != in.end(); ++it)
-    {
-        const auto carry = base58_chars.find(*it);
-        if (carry == std::string::npos)
+        uint8_t* out{};
+        if (!allocate(leading_zeros + bytes, out))
             return false;
 
-        unpack_char(data, carry);
-    }
+        std::fill_n(out, leading_zeros, 0x00_u8);
 
-    // Skip leading zeros in data.
-    const auto first_nonzero = find_first_nonzero(data);
+        // Limbs are written high to low, each filled from its low byte.
+        auto end = std::next(out, leading_zeros + bytes);
+        for (size_t limb = 0; limb < count; ++limb)
+        {
+            auto value = limbs[limb];
+            const auto width = limb == sub1(count) ? high : limb_bytes;
+            for (size_t byte = 0; byte < width; ++byte, value >>= byte_bits)
+                *(--end) = static_cast<uint8_t>(value);
+        }
 
-    // Copy result into output vector.
-    const size_t estimated_size = leading_zeros + (data.end() - first_nonzero);
-    out.reserve(estimated_size);
-    out.assign(leading_zeros, 0x00_u8);
-    out.insert(out.end(), first_nonzero, data.cend());
-    return true;
+        return true;
+    });
 }
 
+bool decode_base58(uint8_t* out, size_t size, const std::string& in) NOEXCEPT
+{
+    return decode(in, [&](size_t length, uint8_t*& buffer) NOEXCEPT
+    {
+        buffer = out;
+        return length == size;
+    });
+}
+
+bool decode_base58(data_chunk& out, const std::string& in) NOEXCEPT
+{
+    out.clear();
+    return decode(in, [&](size_t length, uint8_t*& buffer) NOEXCEPT
+    {
+        out.resize(length);
+        buffer = out.data();
+        return true;
+    });
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+BC_POP_WARNING()
+BC_POP_WARNING()
+
 } // namespace system
 } // namespace libbitcoin
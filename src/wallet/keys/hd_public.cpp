@@ -230,6 +230,34 @@ hd_public hd_public::derive_public(uint32_t index) const NOEXCEPT
     return hd_public(child, intermediate.second, lineage);
 }
 
+compressed_list hd_public::derive_public_range(uint32_t first,
+    size_t count) const NOEXCEPT
+{
+    if (!valid_ || is_zero(count) || lineage_.depth == max_uint8 ||
+        first >= hd_first_hardened_key || count > hd_first_hardened_key - first)
+        return {};
+
+    // The chain code keyed hmac is copied for each child, so that key padding
+    // is compressed once for the range, not twice per child.
+    const hmac<sha512> keyed{ chain_ };
+    secret_list tweaks(count);
+    auto index = first;
+
+    for (auto& tweak: tweaks)
+    {
+        auto code = keyed;
+        code.write(splice(point_, to_big_endian(index++)));
+        tweak = split(code.flush()).first;
+    }
+
+    // The returned child keys Ki are point(parse256(IL)) + Kpar.
+    compressed_list children{};
+    if (!ec_add(children, point_, tweaks))
+        return {};
+
+    return children;
+}
+
 // Helpers.
 // ----------------------------------------------------------------------------
 
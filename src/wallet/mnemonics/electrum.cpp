@@ -18,7 +18,12 @@
  */
 #include <bitcoin/system/wallet/mnemonics/electrum.hpp>
 
+#include <algorithm>
+#include <mutex>
+#include <numeric>
 #include <string>
+#include <utility>
+#include <vector>
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -29,7 +34,9 @@
 #include <bitcoin/system/wallet/keys/ec_private.hpp>
 #include <bitcoin/system/wallet/keys/hd_private.hpp>
 #include <bitcoin/system/wallet/mnemonics/electrum_v1.hpp>
+#include <bitcoin/system/wallet/mnemonics/recovery.hpp>
 #include <bitcoin/system/words/words.hpp>
+#include "enumerator.hpp"
 
 namespace libbitcoin {
 namespace system {
@@ -55,6 +62,13 @@ static const auto version_none = "none";
 static const auto index_bits = narrow_cast<uint8_t>(floored_log2(
     electrum::dictionary::size()));
 
+// Electrum seed derivation parameters.
+constexpr size_t hmac_iterations = 2048;
+constexpr auto passphrase_prefix = "electrum";
+
+// Search candidates seeded per batch, a multiple of sha512 vector lanes.
+constexpr size_t search_batch = 16;
+
 // private static
 // ----------------------------------------------------------------------------
 
@@ -159,12 +173,8 @@ bool electrum::validator(const string_list& words, seed_prefix prefix) NOEXCEPT
 // Electrum uses the same normalization function for words and passphrases.
 // Passpharse entropy loss from lowering (and normalizing) should be considered.
 // github.com/spesmilo/electrum/blob/master/electrum/mnemonic.py#L77
-long_hash electrum::seeder(const string_list& words,
-    const std::string& passphrase) NOEXCEPT
+static bool to_salt(data_chunk& out, const std::string& passphrase) NOEXCEPT
 {
-    constexpr size_t hmac_iterations = 2048;
-    constexpr auto passphrase_prefix = "electrum";
-
     // Passphrase is limited to ascii (normal) if HAVE_ICU undefined.
     std::string phrase{ passphrase };
 
@@ -178,7 +188,7 @@ long_hash electrum::seeder(const string_list& words,
     // ------------------------------------------------------------------------
     // These can only return false if non-ascii phrase and HAVE_ICU undefined.
     if (!to_compatibility_decomposition(phrase) || !to_lower(phrase))
-        return {};
+        return false;
 
     LCOV_EXCL_STOP()
 
@@ -201,7 +211,12 @@ long_hash electrum::seeder(const string_list& words,
     // ------------------------------------------------------------------------
     // Compress ascii whitespace and remove ascii spaces between cjk characters.
     phrase = to_compressed_form(phrase);
+    out = to_chunk(passphrase_prefix + phrase);
+    return true;
+}
 
+static std::string to_sentence(const string_list& words) NOEXCEPT
+{
     // Python unicode splits on all unicode separators:
     // print(u'x\u3000y z'.split()) => [u'x', u'y', u'z']
     // Electrum joins with an ascii space (0x20) as confirmed by test results.
@@ -211,13 +226,35 @@ long_hash electrum::seeder(const string_list& words,
     // Words are normal (lower, nfkd) form even without ICU (dictionary-match).
     auto sentence = system::join(words);
     sentence = to_non_combining_form(sentence);
-    sentence = to_compressed_form(sentence);
+    return to_compressed_form(sentence);
+}
 
-    const auto data = to_chunk(sentence);
-    const auto salt = to_chunk(passphrase_prefix + phrase);
+long_hash electrum::seeder(const string_list& words,
+    const std::string& passphrase) NOEXCEPT
+{
+    data_chunk salt{};
+    if (!to_salt(salt, passphrase))
+        return {};
+
+    const auto data = to_chunk(to_sentence(words));
     return pbkd<sha512>::key<long_hash_size>(data, salt, hmac_iterations);
 }
 
+// Seed derivations are computed concurrently across vector lanes.
+std::vector<long_hash> electrum::seeder(
+    const std::vector<string_list>& phrases, const data_slice& salt) NOEXCEPT
+{
+    string_list sentences(phrases.size());
+    std::transform(phrases.begin(), phrases.end(), sentences.begin(),
+        to_sentence);
+
+    const std::vector<data_slice> passwords(sentences.begin(),
+        sentences.end());
+    const std::vector<data_slice> salts(passwords.size(), salt);
+    return pbkd<sha512>::keys<long_hash_size>(passwords, salts,
+        hmac_iterations);
+}
+
 // protected static (sizers)
 // ----------------------------------------------------------------------------
 
@@ -451,6 +488,100 @@ electrum::seed_prefix electrum::to_prefix(const std::string& sentence) NOEXCEPT
     return to_prefix(split(sentence, language::none));
 }
 
+// Seed version verification precedes seeding, so that only 1/2^(version bits)
+// of candidates incur PBKDF2. Each thread seeds its survivors in batches.
+electrum electrum::search(const string_list& words, seed_prefix prefix,
+    const recovery::matcher& match, const recovery::progress& report,
+    size_t threads, const std::string& passphrase, language identifier,
+    const context& context) NOEXCEPT
+{
+    if (!match || !is_valid_word_count(words.size()))
+        return {};
+
+    // Only native electrum prefixes are seedable.
+    if (!is_seedable(prefix))
+        return {};
+
+    // HACK: 2fa prefix ambiguity.
+    if (is_ambiguous(words.size(), prefix))
+        return {};
+
+    if (!dictionaries_.exists(identifier))
+        return {};
+
+    data_chunk salt{};
+
+    LCOV_EXCL_START("Always succeeds unless HAVE_ICU undefined.")
+
+    if (!to_salt(salt, passphrase))
+        return {};
+
+    LCOV_EXCL_STOP()
+
+    // Normalize to improve chance of dictionary matching (empty is unknown).
+    const auto tokens = try_normalize(words);
+    dictionary::search all(dictionary::size());
+    std::iota(all.begin(), all.end(), zero);
+    const auto lexicon = dictionaries_.at(all, identifier);
+    const enumerator candidates{ tokens,
+        dictionaries_.index(tokens, identifier), lexicon };
+
+    if (!candidates)
+        return {};
+
+    std::mutex mutex{};
+    electrum result{};
+
+    const auto evaluate = [&](uint64_t first, uint64_t last) NOEXCEPT
+    {
+        enumerator::indexes indexes{};
+        std::vector<string_list> phrases{};
+
+        const auto seed = [&]() NOEXCEPT
+        {
+            const auto seeds = seeder(phrases, salt);
+            for (size_t lane = 0; lane < seeds.size(); ++lane)
+            {
+                // The key will be invalid if the secret does not ec verify.
+                const auto key = to_key(seeds.at(lane), context);
+
+                if (key && match(key))
+                {
+                    std::lock_guard lock{ mutex };
+                    if (!result)
+                        result = { decoder(phrases.at(lane), identifier),
+                            phrases.at(lane), identifier, prefix };
+
+                    return true;
+                }
+            }
+
+            phrases.clear();
+            return false;
+        };
+
+        for (auto ordinal = first; ordinal < last; ++ordinal)
+        {
+            candidates.candidate(indexes, ordinal);
+            auto phrase = candidates.phrase(indexes);
+
+            // Avoid collisions with Electrum v1 (en) and BIP39 mnemonics.
+            // Run validator first because conflict checks can be costly.
+            if (!validator(phrase, prefix) || is_conflict(phrase))
+                continue;
+
+            phrases.push_back(std::move(phrase));
+            if (phrases.size() == search_batch && seed())
+                return true;
+        }
+
+        return !phrases.empty() && seed();
+    };
+
+    candidates.run(evaluate, report, threads);
+    return result;
+}
+
 std::string electrum::to_version(seed_prefix prefix) NOEXCEPT
 {
     switch (prefix)
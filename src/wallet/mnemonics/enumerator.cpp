@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "enumerator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/wallet/mnemonics/recovery.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+// Unknown word positions are indicated by max_size_t.
+static enumerator::indexes to_words(const string_list& tokens,
+    const enumerator::result& indexes) NOEXCEPT
+{
+    if (tokens.size() != indexes.size())
+        return {};
+
+    enumerator::indexes words(tokens.size());
+    for (size_t position = 0; position < tokens.size(); ++position)
+    {
+        const auto index = indexes.at(position);
+        if (!is_negative(index))
+            words.at(position) = possible_narrow_sign_cast<size_t>(index);
+        else if (tokens.at(position).empty())
+            words.at(position) = max_size_t;
+        else
+            return {};
+    }
+
+    return words;
+}
+
+static enumerator::indexes to_unknowns(
+    const enumerator::indexes& words) NOEXCEPT
+{
+    enumerator::indexes positions{};
+    for (size_t position = 0; position < words.size(); ++position)
+        if (words.at(position) == max_size_t)
+            positions.push_back(position);
+
+    return positions;
+}
+
+enumerator::enumerator(const string_list& tokens, const result& indexes,
+    const string_list& lexicon) NOEXCEPT
+  : lexicon_(lexicon),
+    words_(to_words(tokens, indexes)),
+    unknowns_(to_unknowns(words_))
+{
+}
+
+enumerator::operator bool() const NOEXCEPT
+{
+    return !words_.empty() && lexicon_.size() > one &&
+        unknowns_.size() <= recovery::maximum_unknowns;
+}
+
+uint64_t enumerator::total() const NOEXCEPT
+{
+    return *this ? power<uint64_t>(lexicon_.size(), unknowns_.size()) : zero;
+}
+
+void enumerator::candidate(indexes& out, uint64_t ordinal) const NOEXCEPT
+{
+    // The last unknown position is the least significant digit.
+    out = words_;
+    for (auto it = unknowns_.rbegin(); it != unknowns_.rend(); ++it)
+    {
+        out.at(*it) = possible_narrow_cast<size_t>(ordinal % lexicon_.size());
+        ordinal /= lexicon_.size();
+    }
+}
+
+string_list enumerator::phrase(const indexes& words) const NOEXCEPT
+{
+    string_list out(words.size());
+    for (size_t position = 0; position < words.size(); ++position)
+        out.at(position) = lexicon_.at(words.at(position));
+
+    return out;
+}
+
+// Chunks are claimed in order, so a single thread search is deterministic.
+// With multiple threads any match may prevail, as each stops the search.
+bool enumerator::run(const evaluator& evaluate,
+    const recovery::progress& report, size_t threads) const NOEXCEPT
+{
+    if (!(*this) || !evaluate)
+        return false;
+
+    const auto count = total();
+    const uint64_t chunk = unknowns_.empty() ? one : lexicon_.size();
+    const auto chunks = count / chunk;
+
+    std::mutex mutex{};
+    uint64_t tried{ zero };
+    std::atomic<uint64_t> next{ zero };
+    std::atomic_bool found{ false };
+    std::atomic_bool stop{ false };
+
+    const auto work = [&]() NOEXCEPT
+    {
+        for (auto index = next++; !stop && index < chunks; index = next++)
+        {
+            const auto first = index * chunk;
+            if (evaluate(first, first + chunk))
+            {
+                found = true;
+                stop = true;
+                return;
+            }
+
+            // Serialize progress so that the tried count is monotonic.
+            std::lock_guard lock{ mutex };
+            tried += chunk;
+            if (report && !stop && !report(tried, count))
+                stop = true;
+        }
+    };
+
+    const auto width = possible_narrow_cast<size_t>(
+        std::min(static_cast<uint64_t>(threads), chunks));
+
+    std_vector<std::thread> workers{};
+    workers.reserve(is_zero(width) ? zero : sub1(width));
+    for (auto thread = one; thread < width; ++thread)
+        workers.emplace_back(work);
+
+    work();
+    for (auto& worker: workers)
+        worker.join();
+
+    return found;
+}
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WALLET_MNEMONICS_ENUMERATOR_HPP
+#define LIBBITCOIN_SYSTEM_WALLET_MNEMONICS_ENUMERATOR_HPP
+
+#include <functional>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/wallet/mnemonics/recovery.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+/// Candidate enumeration for mnemonic and electrum brute force search.
+/// Candidate ordinals [0, total) map to the word indexes of a phrase, with
+/// the last unknown position varying fastest. Ordinals are claimed by threads
+/// in chunks of one dictionary, and progress is reported once per chunk.
+class enumerator
+{
+public:
+    typedef std_vector<size_t> indexes;
+    typedef std::vector<int32_t> result;
+
+    /// Evaluate candidates [first, last), return true if the target is found.
+    typedef std::function<bool(uint64_t first, uint64_t last)> evaluator;
+
+    /// Normalized tokens of the partial phrase (empty tokens are unknown),
+    /// their dictionary indexes (-1 if not found), and the full dictionary.
+    enumerator(const string_list& tokens, const result& indexes,
+        const string_list& lexicon) NOEXCEPT;
+
+    /// False if any known word was not found or too many are unknown.
+    operator bool() const NOEXCEPT;
+
+    /// The number of candidates (one if there are no unknowns).
+    uint64_t total() const NOEXCEPT;
+
+    /// Set the word indexes of the candidate ordinal (sized to phrase).
+    void candidate(indexes& out, uint64_t ordinal) const NOEXCEPT;
+
+    /// The dictionary words of the candidate word indexes.
+    string_list phrase(const indexes& words) const NOEXCEPT;
+
+    /// Evaluate all candidates across threads, until found or cancelled.
+    /// Progress is invoked serially, returns true if target was found.
+    bool run(const evaluator& evaluate, const recovery::progress& report,
+        size_t threads) const NOEXCEPT;
+
+private:
+    const string_list& lexicon_;
+    const indexes words_;
+    const indexes unknowns_;
+};
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
+
+#endif
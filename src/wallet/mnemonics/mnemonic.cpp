@@ -18,7 +18,12 @@
  */
 #include <bitcoin/system/wallet/mnemonics/mnemonic.hpp>
 
+#include <algorithm>
+#include <mutex>
+#include <numeric>
 #include <string>
+#include <utility>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/math/math.hpp>
@@ -26,7 +31,9 @@
 #include <bitcoin/system/unicode/unicode.hpp>
 #include <bitcoin/system/wallet/context.hpp>
 #include <bitcoin/system/wallet/keys/hd_private.hpp>
+#include <bitcoin/system/wallet/mnemonics/recovery.hpp>
 #include <bitcoin/system/words/words.hpp>
+#include "enumerator.hpp"
 
 namespace libbitcoin {
 namespace system {
@@ -35,10 +42,29 @@ namespace wallet {
 // local constants
 // ----------------------------------------------------------------------------
 
+// BIP39 seed derivation parameters.
+constexpr size_t hmac_iterations = 2048;
+constexpr auto passphrase_prefix = "mnemonic";
+
 // 2^11 = 2048 implies 11 bits exactly indexes every possible dictionary word.
 static const auto index_bits = narrow_cast<uint8_t>(
     system::floored_log2(mnemonic::dictionary::size()));
 
+// Search candidates seeded per batch, a multiple of sha512 vector lanes.
+constexpr size_t search_batch = 16;
+
+// Words are the base2048 decoding, so this is word encoding (of indexes).
+static void encode_indexes(data_chunk& out,
+    const enumerator::indexes& indexes) NOEXCEPT
+{
+    size_t bit{ zero };
+    std::fill(out.begin(), out.end(), uint8_t{});
+    for (const auto index: indexes)
+        for (auto offset = index_bits; !is_zero(offset); ++bit)
+            if (get_right(index, --offset))
+                set_left_into(out.at(bit / byte_bits), bit % byte_bits);
+}
+
 // private static
 // ----------------------------------------------------------------------------
 
@@ -88,9 +114,6 @@ data_chunk mnemonic::decoder(const string_list& words,
 long_hash mnemonic::seeder(const string_list& words,
     const std::string& passphrase) NOEXCEPT
 {
-    constexpr size_t hmac_iterations = 2048;
-    constexpr auto passphrase_prefix = "mnemonic";
-
     // Passphrase is limited to ascii (normal) if HAVE_ICU undefind.
     std::string phrase{ passphrase };
 
@@ -107,6 +130,61 @@ long_hash mnemonic::seeder(const string_list& words,
         passphrase_prefix + phrase, hmac_iterations);
 }
 
+std::vector<long_hash> mnemonic::seeder(const string_list& words,
+    const string_list& passphrases) NOEXCEPT
+{
+    std::vector<long_hash> seeds(passphrases.size());
+    std::vector<size_t> positions{};
+    string_list salts{};
+
+    for (size_t position = 0; position < passphrases.size(); ++position)
+    {
+        // Passphrase is limited to ascii (normal) if HAVE_ICU undefind.
+        std::string phrase{ passphrases.at(position) };
+
+        LCOV_EXCL_START("Always succeeds unless HAVE_ICU undefined.")
+
+        // Unlike Electrum, BIP39 does not perform any further normalization.
+        if (!to_compatibility_decomposition(phrase))
+            continue;
+
+        LCOV_EXCL_STOP()
+
+        positions.push_back(position);
+        salts.push_back(passphrase_prefix + phrase);
+    }
+
+    // Words are in normal (lower, nfkd) form, even without ICU.
+    const auto sentence = system::join(words);
+    const std::vector<data_slice> passwords(salts.size(), sentence);
+    const std::vector<data_slice> slices(salts.begin(), salts.end());
+    const auto keys = pbkd<sha512>::keys<long_hash_size>(passwords, slices,
+        hmac_iterations);
+
+    for (size_t key = 0; key < keys.size(); ++key)
+        seeds.at(positions.at(key)) = keys.at(key);
+
+    return seeds;
+}
+
+std::vector<long_hash> mnemonic::seeder(
+    const std::vector<string_list>& phrases, const data_slice& salt) NOEXCEPT
+{
+    // Words are in normal (lower, nfkd) form, even without ICU.
+    string_list sentences(phrases.size());
+    std::transform(phrases.begin(), phrases.end(), sentences.begin(),
+        [](const string_list& words) NOEXCEPT
+        {
+            return system::join(words);
+        });
+
+    const std::vector<data_slice> passwords(sentences.begin(),
+        sentences.end());
+    const std::vector<data_slice> salts(passwords.size(), salt);
+    return pbkd<sha512>::keys<long_hash_size>(passwords, salts,
+        hmac_iterations);
+}
+
 uint8_t mnemonic::checksum_byte(const data_chunk& entropy) NOEXCEPT
 {
     // The high order bits of the first sha256_hash byte are the checksum.
@@ -189,6 +267,102 @@ bool mnemonic::is_valid_word_count(size_t count) NOEXCEPT
         count >= word_minimum && count <= word_maximum);
 }
 
+// Checksum verification precedes seeding, so that only 1/2^(checksum bits)
+// of candidates incur PBKDF2. Each thread seeds its survivors in batches.
+mnemonic mnemonic::search(const string_list& words,
+    const recovery::matcher& match, const recovery::progress& report,
+    size_t threads, const std::string& passphrase, language identifier,
+    const context& context) NOEXCEPT
+{
+    if (!match || !is_valid_word_count(words.size()))
+        return {};
+
+    if (!dictionaries_.exists(identifier))
+        return {};
+
+    // Passphrase is limited to ascii (normal) if HAVE_ICU undefind.
+    std::string phrase{ passphrase };
+
+    LCOV_EXCL_START("Always succeeds unless HAVE_ICU undefined.")
+
+    // Unlike Electrum, BIP39 does not perform any further normalization.
+    if (!to_compatibility_decomposition(phrase))
+        return {};
+
+    LCOV_EXCL_STOP()
+
+    const auto salt = to_chunk(passphrase_prefix + phrase);
+
+    // Normalize to improve chance of dictionary matching (empty is unknown).
+    const auto tokens = try_normalize(words);
+    dictionary::search all(dictionary::size());
+    std::iota(all.begin(), all.end(), zero);
+    const auto lexicon = dictionaries_.at(all, identifier);
+    const enumerator candidates{ tokens,
+        dictionaries_.index(tokens, identifier), lexicon };
+
+    if (!candidates)
+        return {};
+
+    std::mutex mutex{};
+    mnemonic result{};
+    const auto size = entropy_size(tokens);
+
+    const auto evaluate = [&](uint64_t first, uint64_t last) NOEXCEPT
+    {
+        enumerator::indexes indexes{};
+        data_chunk buffer(add1(size));
+        std::vector<data_chunk> entropies{};
+        std::vector<string_list> phrases{};
+
+        const auto seed = [&]() NOEXCEPT
+        {
+            const auto seeds = seeder(phrases, salt);
+            for (size_t lane = 0; lane < seeds.size(); ++lane)
+            {
+                // The key will be invalid if the secret does not ec verify.
+                const hd_private key{ to_chunk(seeds.at(lane)),
+                    context.hd_prefixes() };
+
+                if (key && match(key))
+                {
+                    std::lock_guard lock{ mutex };
+                    if (!result)
+                        result = { entropies.at(lane), phrases.at(lane),
+                            identifier };
+
+                    return true;
+                }
+            }
+
+            entropies.clear();
+            phrases.clear();
+            return false;
+        };
+
+        for (auto ordinal = first; ordinal < last; ++ordinal)
+        {
+            candidates.candidate(indexes, ordinal);
+            encode_indexes(buffer, indexes);
+
+            // Checksum is in high order bits of last buffer byte, zero-padded.
+            data_chunk entropy{ buffer.begin(), std::prev(buffer.end()) };
+            if (buffer.back() != checksum_byte(entropy))
+                continue;
+
+            entropies.push_back(std::move(entropy));
+            phrases.push_back(candidates.phrase(indexes));
+            if (phrases.size() == search_batch && seed())
+                return true;
+        }
+
+        return !phrases.empty() && seed();
+    };
+
+    candidates.run(evaluate, report, threads);
+    return result;
+}
+
 // construction
 // ----------------------------------------------------------------------------
 
@@ -276,6 +450,15 @@ long_hash mnemonic::to_seed(const std::string& passphrase) const NOEXCEPT
     return seeder(words(), passphrase);
 }
 
+std::vector<long_hash> mnemonic::to_seeds(
+    const string_list& passphrases) const NOEXCEPT
+{
+    if (!(*this))
+        return std::vector<long_hash>(passphrases.size());
+
+    return seeder(words(), passphrases);
+}
+
 hd_private mnemonic::to_key(const std::string& passphrase,
     const context& context) const NOEXCEPT
 {
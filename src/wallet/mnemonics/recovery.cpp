@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/wallet/mnemonics/recovery.hpp>
+
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/wallet/addresses/payment_address.hpp>
+#include <bitcoin/system/wallet/keys/ec_public.hpp>
+#include <bitcoin/system/wallet/keys/hd_private.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+static hd_private derive(const hd_private& key,
+    const std_vector<uint32_t>& path, size_t depth) NOEXCEPT
+{
+    return depth == path.size() ? key :
+        derive(key.derive_private(path.at(depth)), path, add1(depth));
+}
+
+recovery::matcher recovery::match_fingerprint(uint32_t fingerprint) NOEXCEPT
+{
+    return [fingerprint](const hd_private& key) NOEXCEPT
+    {
+        // The identifier prefix of the master public key (hd_public).
+        const auto point = key.to_public().point();
+        return from_big_endian<uint32_t>(bitcoin_short_hash(point)) ==
+            fingerprint;
+    };
+}
+
+recovery::matcher recovery::match_address(const payment_address& address,
+    const std_vector<uint32_t>& path) NOEXCEPT
+{
+    return [address, path](const hd_private& key) NOEXCEPT
+    {
+        const auto child = derive(key, path, zero);
+        const ec_public point{ child.to_public().point() };
+        return child && payment_address{ point, address.prefix() } == address;
+    };
+}
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
@@ -37,6 +37,38 @@ constexpr uint64_t golomb_target_false_positive_rate = 784931;
 
 constexpr auto rate = golomb_target_false_positive_rate;
 
+// Matched targets are the (ordered) serializations of non-empty scripts.
+static data_stack to_targets(const chain::scripts& scripts) NOEXCEPT
+{
+    data_stack stack{};
+    stack.reserve(scripts.size());
+
+    // ordered
+    std::for_each(scripts.begin(), scripts.end(),
+        [&](const auto& script) NOEXCEPT
+        {
+            if (!script.ops().empty())
+                stack.push_back(script.to_data(false));
+        });
+
+    stack.shrink_to_fit();
+    return stack;
+}
+
+static chain::scripts to_scripts(
+    const wallet::payment_address::list& addresses) NOEXCEPT
+{
+    chain::scripts scripts(addresses.size());
+
+    std::transform(addresses.begin(), addresses.end(), scripts.begin(),
+        [](const wallet::payment_address& address) NOEXCEPT
+        {
+            return address.output_script();
+        });
+
+    return scripts;
+}
+
 bool compute_filter(data_chunk& out, const chain::block& block) NOEXCEPT
 {
     const auto hash = block.hash();
@@ -121,20 +153,7 @@ bool match_filter(const block_filter& filter,
 bool match_filter(const block_filter& filter,
     const chain::scripts& scripts) NOEXCEPT
 {
-    if (scripts.empty())
-        return false;
-
-    data_stack stack{};
-    stack.reserve(scripts.size());
-
-    // ordered
-    std::for_each(scripts.begin(), scripts.end(),
-        [&](const auto& script) NOEXCEPT
-        {
-            if (!script.ops().empty())
-                stack.push_back(script.to_data(false));
-        });
-
+    const auto stack = to_targets(scripts);
     if (stack.empty())
         return false;
 
@@ -151,7 +170,6 @@ bool match_filter(const block_filter& filter,
     const auto hash = slice<zero, to_half(hash_size)>(filter.hash);
     const auto key = to_siphash_key(hash);
 
-    stack.shrink_to_fit();
     return golomb::match(stack, stream, set_size, key, golomb_bits, rate);
 }
 
@@ -167,15 +185,65 @@ bool match_filter(const block_filter& filter,
     if (addresses.empty())
         return false;
 
-    chain::scripts stack(addresses.size());
+    return match_filter(filter, to_scripts(addresses));
+}
 
-    std::transform(addresses.begin(), addresses.end(), stack.begin(),
-        [](const wallet::payment_address& address) NOEXCEPT
-        {
-            return address.output_script();
-        });
+// Decoded filter.
+// ----------------------------------------------------------------------------
+
+bool decode_filter(decoded_filter& out, const block_filter& filter) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    stream::in::copy stream(filter.filter);
+    BC_POP_WARNING()
+
+    read::bytes::istream reader(stream);
+    const auto set_size = reader.read_variable();
+
+    if (!reader)
+        return false;
+
+    out.set = golomb::decode(stream, set_size, golomb_bits);
+    if (out.set.size() != set_size)
+        return false;
+
+    out.key = to_siphash_key(slice<zero, to_half(hash_size)>(filter.hash));
+    return true;
+}
+
+bool match_filter(const decoded_filter& filter,
+    const chain::script& script) NOEXCEPT
+{
+    if (script.ops().empty())
+        return false;
+
+    return golomb::match(script.to_data(false), filter.set, filter.key,
+        rate);
+}
+
+bool match_filter(const decoded_filter& filter,
+    const chain::scripts& scripts) NOEXCEPT
+{
+    const auto stack = to_targets(scripts);
+    if (stack.empty())
+        return false;
+
+    return golomb::match(stack, filter.set, filter.key, rate);
+}
+
+bool match_filter(const decoded_filter& filter,
+    const wallet::payment_address& address) NOEXCEPT
+{
+    return match_filter(filter, address.output_script());
+}
+
+bool match_filter(const decoded_filter& filter,
+    const wallet::payment_address::list& addresses) NOEXCEPT
+{
+    if (addresses.empty())
+        return false;
 
-    return match_filter(filter, stack);
+    return match_filter(filter, to_scripts(addresses));
 }
 
 } // namespace neutrino
@@ -24,8 +24,8 @@ namespace words {
 namespace electrum_v1 {
 
 // github.com/spesmilo/electrum/blob/master/electrum/old_mnemonic.py
-const catalog::words en
-{
+constexpr catalog::words en = catalog::hash
+(
     false,
     {
         "like",
@@ -1655,11 +1655,11 @@ const catalog::words en
         "weapon",
         "weary"
     }
-};
+);
 
 // github.com/spesmilo/electrum/blob/master/electrum/wordlist/portuguese.txt
-const catalog::words pt
-{
+constexpr catalog::words pt = catalog::hash
+(
     false,
     {
         "abaular",
@@ -3289,7 +3289,7 @@ const catalog::words pt
         "zenite",
         "zumbi"
     }
-};
+);
 
 } // namespace electrum_v1
 } // namespace words
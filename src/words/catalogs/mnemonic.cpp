@@ -26,8 +26,8 @@ namespace mnemonic {
 // BIP39 word lists from:
 // github.com/bitcoin/bips/blob/master/bip-0039/bip-0039-wordlists.md
 
-const catalog::words en
-{
+constexpr catalog::words en = catalog::hash
+(
     true,
     {
         "abandon",
@@ -2079,10 +2079,10 @@ const catalog::words en
         "zone",
         "zoo"
     }
-};
+);
 
-const catalog::words es
-{
+constexpr catalog::words es = catalog::hash
+(
     false,
     {
         "ábaco",
@@ -4134,10 +4134,10 @@ const catalog::words es
         "zumo",
         "zurdo"
     }
-};
+);
 
-const catalog::words it
-{
+constexpr catalog::words it = catalog::hash
+(
     true,
     {
         "abaco",
@@ -6189,10 +6189,10 @@ const catalog::words it
         "zulu",
         "zuppa"
     }
-};
+);
 
-const catalog::words fr
-{
+constexpr catalog::words fr = catalog::hash
+(
     false,
     {
         "abaisser",
@@ -8244,10 +8244,10 @@ const catalog::words fr
         "zeste",
         "zoologie"
     }
-};
+);
 
-const catalog::words cs
-{
+constexpr catalog::words cs = catalog::hash
+(
     false,
     {
         "abdikace",
@@ -10299,10 +10299,10 @@ const catalog::words cs
         "zvukovod",
         "zvyk"
     }
-};
+);
 
-const catalog::words pt
-{
+constexpr catalog::words pt = catalog::hash
+(
     true,
     {
         "abacate",
@@ -12354,10 +12354,10 @@ const catalog::words pt
         "zoologia",
         "zumbido"
     }
-};
+);
 
-const catalog::words ja
-{
+constexpr catalog::words ja = catalog::hash
+(
     false,
     {
         "あいこくしん",
@@ -14409,10 +14409,10 @@ const catalog::words ja
         "わらう",
         "われる"
     }
-};
+);
 
-const catalog::words ko
-{
+constexpr catalog::words ko = catalog::hash
+(
     true,
     {
         "가격",
@@ -16464,10 +16464,10 @@ const catalog::words ko
         "흰색",
         "힘껏"
     }
-};
+);
 
-const catalog::words zh_Hans
-{
+constexpr catalog::words zh_Hans = catalog::hash
+(
     false,
     {
         "的",
@@ -18519,10 +18519,10 @@ const catalog::words zh_Hans
         "矮",
         "歇"
     }
-};
+);
 
-const catalog::words zh_Hant
-{
+constexpr catalog::words zh_Hant = catalog::hash
+(
     false,
     {
         "的",
@@ -20574,7 +20574,7 @@ const catalog::words zh_Hant
         "矮",
         "歇"
     }
-};
+);
 
 } // namespace mnemonic
 } // namespace words
@@ -455,7 +455,103 @@ BOOST_AUTO_TEST_CASE(block__hash__default__matches_header_hash)
 
 // check
 // accept
-// connect
+
+static const block& connect_block() NOEXCEPT
+{
+    static const block instance
+    {
+        header{},
+        transactions
+        {
+            { 1, inputs{ {} }, outputs{ {} }, 0 },
+            { 1, inputs{ {}, {}, {} }, outputs{ {} }, 0 },
+            { 1, inputs{ {}, {} }, outputs{ {} }, 0 }
+        }
+    };
+
+    // Inputs: coinbase, true, true, false, missing, true.
+    // Block inputs are collected into a new list, so retain it while in use.
+    const auto ins = instance.inputs_ptr();
+    const auto pass = to_shared<output>(0_u64, script{ { opcode::push_positive_1 } });
+    const auto fail = to_shared<output>(0_u64, script{ { opcode::push_size_0 } });
+    ins->at(1)->prevout = pass;
+    ins->at(2)->prevout = pass;
+    ins->at(3)->prevout = fail;
+    ins->at(5)->prevout = pass;
+    return instance;
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__default__success)
+{
+    const block instance{};
+    BOOST_REQUIRE_EQUAL(instance.connect({}), error::block_success);
+    BOOST_REQUIRE_EQUAL(instance.connect({}, 4), error::block_success);
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__coinbase_only_threads__success)
+{
+    const block instance
+    {
+        header{},
+        transactions
+        {
+            { 1, inputs{ {} }, outputs{ {} }, 0 }
+        }
+    };
+
+    BOOST_REQUIRE_EQUAL(instance.connect({}, 4), error::block_success);
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__first_failure__expected)
+{
+    const auto& instance = connect_block();
+    BOOST_REQUIRE_EQUAL(instance.connect({}), error::stack_false);
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__threads__matches_sequential)
+{
+    const auto& instance = connect_block();
+    const auto expected = instance.connect({});
+
+    for (auto threads = zero; threads <= 8u; ++threads)
+    {
+        BOOST_REQUIRE_EQUAL(instance.connect({}, threads), expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(block__connect_batched__default__success)
+{
+    const block instance{};
+    BOOST_REQUIRE_EQUAL(instance.connect_batched({}), error::block_success);
+}
+
+BOOST_AUTO_TEST_CASE(block__connect_batched__first_failure__matches_sequential)
+{
+    const auto& instance = connect_block();
+    BOOST_REQUIRE_EQUAL(instance.connect_batched({}), instance.connect({}));
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__threads_all_true__success)
+{
+    const block instance
+    {
+        header{},
+        transactions
+        {
+            { 1, inputs{ {} }, outputs{ {} }, 0 },
+            { 1, inputs{ {}, {} }, outputs{ {} }, 0 },
+            { 1, inputs{ {} }, outputs{ {} }, 0 }
+        }
+    };
+
+    const auto pass = to_shared<output>(0_u64, script{ { opcode::push_positive_1 } });
+    const auto ins = instance.inputs_ptr();
+    for (const auto& in: *ins)
+        in->prevout = pass;
+
+    BOOST_REQUIRE_EQUAL(instance.connect({}), error::block_success);
+    BOOST_REQUIRE_EQUAL(instance.connect({}, 3), error::block_success);
+}
 
 // validation (protected)
 // ----------------------------------------------------------------------------
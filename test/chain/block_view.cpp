@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(block_view_tests)
+
+using namespace system::chain;
+
+// Script and witness text parsing is not safe for static initialization.
+static block segregated_block() NOEXCEPT
+{
+    const transaction coinbase
+    {
+        1,
+        inputs
+        {
+            { point{}, script{ "[0102]" }, witness{ "[" + encode_base16(null_hash) + "]" }, max_uint32 }
+        },
+        outputs
+        {
+            { 5000, script{ "[03030303] checksig" } }
+        },
+        0
+    };
+
+    const transaction segregated
+    {
+        2,
+        inputs
+        {
+            {
+                point{ base16_hash("0102030405060708091011121314151617181920212223242526272829303132"), 1 },
+                script{},
+                witness{ "[424242] [0303030303]" },
+                max_uint32
+            }
+        },
+        outputs
+        {
+            { 1234, script{ "0 [00112233445566778899aabbccddeeff00112233]" } }
+        },
+        0
+    };
+
+    const transaction legacy
+    {
+        1,
+        inputs
+        {
+            { point{ segregated.hash(false), 0 }, script{ "[0011223344]" }, witness{}, 42 }
+        },
+        outputs
+        {
+            { 1000, script{ "return" } },
+            { 234, script{ "[03030303] checksig" } }
+        },
+        7
+    };
+
+    return
+    {
+        header{ 1, null_hash, null_hash, 2, 3, 4 },
+        transactions{ coinbase, segregated, legacy }
+    };
+}
+
+static void check_equal(const block_view& view, const block& instance)
+{
+    BOOST_REQUIRE(view.is_valid());
+    BOOST_REQUIRE_EQUAL(view.is_segregated(), instance.is_segregated());
+    BOOST_REQUIRE_EQUAL(view.serialized_size(false), instance.serialized_size(false));
+    BOOST_REQUIRE_EQUAL(view.serialized_size(true), instance.serialized_size(true));
+    BOOST_REQUIRE_EQUAL(view.hash(), instance.hash());
+    BOOST_REQUIRE(view.header() == instance.header());
+
+    const auto& txs = *instance.transactions_ptr();
+    BOOST_REQUIRE_EQUAL(view.transactions().size(), txs.size());
+
+    auto tx = txs.begin();
+    for (const auto& transaction: view.transactions())
+    {
+        const auto& expected = **tx++;
+        BOOST_REQUIRE(transaction.is_valid());
+        BOOST_REQUIRE_EQUAL(transaction.hash(false), expected.hash(false));
+        BOOST_REQUIRE_EQUAL(transaction.hash(true), expected.hash(true));
+        BOOST_REQUIRE(transaction.to_transaction(true) == expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(block_view__constructor__default__invalid)
+{
+    const block_view instance{};
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.transactions().empty());
+    BOOST_REQUIRE_EQUAL(instance.hash(), null_hash);
+}
+
+BOOST_AUTO_TEST_CASE(block_view__constructor__truncated__invalid)
+{
+    const auto expected = segregated_block();
+    const auto data = expected.to_data(true);
+    const block_view instance{ { data.begin(), std::prev(data.end()) } };
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.transactions().empty());
+}
+
+BOOST_AUTO_TEST_CASE(block_view__constructor__genesis__expected)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const auto data = genesis.to_data(true);
+    const block_view instance{ data };
+    check_equal(instance, genesis);
+    BOOST_REQUIRE_EQUAL(instance.data(), data);
+    BOOST_REQUIRE(instance.transactions().begin()->is_coinbase());
+}
+
+BOOST_AUTO_TEST_CASE(block_view__constructor__segregated__expected)
+{
+    const auto expected = segregated_block();
+    const auto data = expected.to_data(true);
+    const block_view instance{ data };
+    BOOST_REQUIRE(instance.is_segregated());
+    check_equal(instance, expected);
+}
+
+BOOST_AUTO_TEST_CASE(block_view__constructor__trailing_bytes__not_viewed)
+{
+    auto data = segregated_block().to_data(true);
+    const auto size = data.size();
+    data.push_back(0x42);
+    const block_view instance{ data };
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(true), size);
+}
+
+BOOST_AUTO_TEST_CASE(block_view__transactions__segregated__expected_views)
+{
+    const auto expected = segregated_block();
+    const auto data = expected.to_data(true);
+    const block_view instance{ data };
+    const auto txs = instance.transactions();
+    auto it = txs.begin();
+
+    BOOST_REQUIRE(it->is_coinbase());
+    BOOST_REQUIRE_EQUAL(it->hash(true), null_hash);
+    BOOST_REQUIRE_EQUAL((++it)->outputs().begin()->value(), 1234u);
+    BOOST_REQUIRE(!(++it)->is_segregated());
+    BOOST_REQUIRE((++it) == txs.end());
+}
+
+BOOST_AUTO_TEST_CASE(block_view__to_block__segregated__hashes_cached)
+{
+    const auto expected = segregated_block();
+    const auto data = expected.to_data(true);
+    const block_view instance{ data };
+    const auto witnessed = instance.to_block(true);
+    BOOST_REQUIRE(witnessed == expected);
+    BOOST_REQUIRE_EQUAL(witnessed.transaction_hashes(false), expected.transaction_hashes(false));
+    BOOST_REQUIRE_EQUAL(witnessed.transaction_hashes(true), expected.transaction_hashes(true));
+
+    const auto nominal = instance.to_block(false);
+    BOOST_REQUIRE(nominal.is_valid());
+    BOOST_REQUIRE_EQUAL(nominal.transaction_hashes(false), expected.transaction_hashes(false));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
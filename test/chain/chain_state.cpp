@@ -57,4 +57,19 @@ BOOST_AUTO_TEST_CASE(chain_state__work_required_retarget__overflow_patch_enabled
     BOOST_REQUIRE_EQUAL(work, settings.proof_of_work_limit);
 }
 
+BOOST_AUTO_TEST_CASE(chain_state__cumulative_work__header__accumulated)
+{
+    const settings settings(chain::selection::mainnet);
+    const chain::block genesis{ settings.genesis_block };
+    auto values = get_values(settings.retargeting_interval());
+    values.hash = genesis.hash();
+    values.cumulative_work = genesis.header().proof();
+    const chain::chain_state parent{ std::move(values), settings };
+
+    const chain::header header{ 1, genesis.hash(), {}, 1692625u, 0x1d00ffffu, 0 };
+    const chain::chain_state child{ parent, header, settings };
+    BOOST_REQUIRE_EQUAL(parent.cumulative_work(), 0x0000000100010001);
+    BOOST_REQUIRE_EQUAL(child.cumulative_work(), 0x0000000200020002);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
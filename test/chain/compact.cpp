@@ -272,3 +272,30 @@ static_assert(ceilinged_log256(0x0000fffful) == 2);
 // > 0x0000ffff (<= 0x007ffffful) (overflow if exponent > 29 and ceilinged_log256(mantissa) > 3)
 static_assert(ceilinged_log256(0x00010000ul) == 3);
 static_assert(ceilinged_log256(0x007ffffful) == 3);
+
+// expand_fixed
+
+static_assert(compact::expand_fixed(0x1d00ffff).width() == 224u);
+static_assert(!compact::expand_fixed(0x00000000));
+static_assert(!compact::expand_fixed(0x01800000));
+
+BOOST_AUTO_TEST_SUITE(compact_tests)
+
+BOOST_AUTO_TEST_CASE(compact__expand_fixed__all_exponents__expand)
+{
+    constexpr std::array<uint32_t, 8> mantissas
+    {
+        0x000000, 0x000001, 0x0000ff, 0x00ffff, 0x007fff, 0x7fffff, 0x800000, 0xffffff
+    };
+
+    for (uint32_t exponent = 0; exponent <= 0xff; ++exponent)
+    {
+        for (const auto mantissa: mantissas)
+        {
+            const auto bits = (exponent << 24) | mantissa;
+            BOOST_REQUIRE_EQUAL(compact::expand_fixed(bits).to_uintx(), compact::expand(bits));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,214 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(compact_transaction_tests)
+
+using namespace system::chain;
+
+static const auto tx_data = base16_chunk(
+    "0100000001f08e44a96bfb5ae63eda1a6620adae37ee37ee4777fb0336e1bbbc"
+    "4de65310fc010000006a473044022050d8368cacf9bf1b8fb1f7cfd9aff63294"
+    "789eb1760139e7ef41f083726dadc4022067796354aba8f2e02363c5e510aa7e"
+    "2830b115472fb31de67d16972867f13945012103e589480b2f746381fca01a9b"
+    "12c517b7a482a203c8b2742985da0ac72cc078f2ffffffff02f0c9c467000000"
+    "001976a914d9d78e26df4e4601cf9b26d09c7b280ee764469f88ac80c4600f00"
+    "0000001976a9141ee32412020a324b93b1a1acfdfff6ab9ca8fac288ac000000"
+    "00");
+
+// Script and witness text parsing is not safe for static initialization.
+static transaction segregated_tx() NOEXCEPT
+{
+    const inputs ins
+    {
+        {
+            point{ base16_hash("0102030405060708091011121314151617181920212223242526272829303132"), 7 },
+            script{},
+            witness{ "[424242] [0303030303]" },
+            0xfffffffe
+        },
+        {
+            point{ base16_hash("3132333435363738394041424344454647484950515253545556575859606162"), 0 },
+            script{ "[0011223344]" },
+            witness{},
+            42
+        }
+    };
+
+    const outputs outs
+    {
+        { 1234, script{ "0 [00112233445566778899aabbccddeeff00112233]" } },
+        { 5678, script{ "return" } }
+    };
+
+    return { 2, ins, outs, 9 };
+}
+
+static void check_equal(const compact_transaction& compact,
+    const transaction& tx)
+{
+    BOOST_REQUIRE(compact.is_valid());
+    BOOST_REQUIRE_EQUAL(compact.is_segregated(), tx.is_segregated());
+    BOOST_REQUIRE_EQUAL(compact.is_coinbase(), tx.is_coinbase());
+    BOOST_REQUIRE_EQUAL(compact.version(), tx.version());
+    BOOST_REQUIRE_EQUAL(compact.locktime(), tx.locktime());
+    BOOST_REQUIRE_EQUAL(compact.claim(), tx.claim());
+    BOOST_REQUIRE_EQUAL(compact.serialized_size(false), tx.serialized_size(false));
+    BOOST_REQUIRE_EQUAL(compact.serialized_size(true), tx.serialized_size(true));
+    BOOST_REQUIRE_EQUAL(compact.to_data(false), tx.to_data(false));
+    BOOST_REQUIRE_EQUAL(compact.to_data(true), tx.to_data(true));
+    BOOST_REQUIRE_EQUAL(compact.hash(false), tx.hash(false));
+    BOOST_REQUIRE_EQUAL(compact.hash(true), tx.hash(true));
+
+    const auto& ins = *tx.inputs_ptr();
+    BOOST_REQUIRE_EQUAL(compact.inputs(), ins.size());
+    for (size_t index = 0; index < ins.size(); ++index)
+    {
+        const auto& in = *ins[index];
+        BOOST_REQUIRE(compact.point(index) == in.point());
+        BOOST_REQUIRE_EQUAL(compact.point_index(index), in.point().index());
+        BOOST_REQUIRE_EQUAL(compact.sequence(index), in.sequence());
+        BOOST_REQUIRE_EQUAL(data_chunk(compact.point_hash(index).begin(),
+            compact.point_hash(index).end()), to_chunk(in.point().hash()));
+        BOOST_REQUIRE_EQUAL(data_chunk(compact.input_script(index).begin(),
+            compact.input_script(index).end()), in.script().to_data(false));
+    }
+
+    const auto& outs = *tx.outputs_ptr();
+    BOOST_REQUIRE_EQUAL(compact.outputs(), outs.size());
+    for (size_t index = 0; index < outs.size(); ++index)
+    {
+        const auto& out = *outs[index];
+        BOOST_REQUIRE_EQUAL(compact.value(index), out.value());
+        BOOST_REQUIRE_EQUAL(data_chunk(compact.output_script(index).begin(),
+            compact.output_script(index).end()), out.script().to_data(false));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(compact_transaction__constructor__default__invalid)
+{
+    const compact_transaction instance{};
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(!instance.to_transaction().is_valid());
+    BOOST_REQUIRE_EQUAL(instance.allocation(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(compact_transaction__constructor__invalid_transaction__invalid)
+{
+    const compact_transaction instance{ transaction{} };
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(compact_transaction__constructor__legacy__expected)
+{
+    const transaction tx{ tx_data, true };
+    BOOST_REQUIRE(tx.is_valid());
+
+    const compact_transaction instance{ tx };
+    check_equal(instance, tx);
+    BOOST_REQUIRE(instance.witness(0).empty());
+    BOOST_REQUIRE(!instance.is_populated(0));
+}
+
+BOOST_AUTO_TEST_CASE(compact_transaction__constructor__segregated__expected)
+{
+    const auto tx = segregated_tx();
+    BOOST_REQUIRE(tx.is_segregated());
+
+    const compact_transaction instance{ tx };
+    check_equal(instance, tx);
+
+    const auto& ins = *tx.inputs_ptr();
+    const auto witness = instance.witness(0);
+    BOOST_REQUIRE_EQUAL(data_chunk(witness.begin(), witness.end()),
+        ins.front()->witness().to_data(true));
+    BOOST_REQUIRE(instance.witness(1).empty());
+}
+
+BOOST_AUTO_TEST_CASE(compact_transaction__allocation__legacy__expected)
+{
+    const transaction tx{ tx_data, true };
+    const compact_transaction instance{ tx };
+
+    // Fixed: 1 * (36 + 4 + 8 + 8 + 4 + 1) + 2 * 8 + (3 * 1 + 2 + 1) * 4 = 101.
+    // Pool: 106 + 25 + 25 = 156 (unprefixed scripts).
+    BOOST_REQUIRE_EQUAL(instance.allocation(), 101u + 156u);
+}
+
+BOOST_AUTO_TEST_CASE(compact_transaction__to_transaction__segregated__round_trip)
+{
+    const auto tx = segregated_tx();
+    const compact_transaction instance{ tx };
+    const auto copy = instance.to_transaction();
+    BOOST_REQUIRE(copy.is_valid());
+    BOOST_REQUIRE(copy == tx);
+    BOOST_REQUIRE(compact_transaction{ copy } == instance);
+}
+
+BOOST_AUTO_TEST_CASE(compact_transaction__to_transaction__populated_prevout__retained)
+{
+    const auto tx = segregated_tx();
+    const auto& ins = *tx.inputs_ptr();
+    ins.front()->prevout = to_shared<output>(42u, script{ "1" });
+
+    const compact_transaction instance{ tx };
+    BOOST_REQUIRE(instance.is_populated(0));
+    BOOST_REQUIRE(!instance.is_populated(1));
+    BOOST_REQUIRE_EQUAL(instance.prevout_value(0), 42u);
+    BOOST_REQUIRE_EQUAL(instance.prevout_value(1), 0u);
+    BOOST_REQUIRE(instance.prevout_script(1).empty());
+
+    const auto copy = instance.to_transaction();
+    const auto& prevout = copy.inputs_ptr()->front()->prevout;
+    BOOST_REQUIRE(prevout);
+    BOOST_REQUIRE_EQUAL(prevout->value(), 42u);
+    BOOST_REQUIRE(prevout->script() == script{ "1" });
+    BOOST_REQUIRE(!copy.inputs_ptr()->back()->prevout);
+}
+
+BOOST_AUTO_TEST_CASE(compact_transaction__to_transaction__metadata__retained)
+{
+    const auto tx = segregated_tx();
+    const auto& ins = *tx.inputs_ptr();
+    ins.front()->prevout = to_shared<output>(42u, script{ "1" });
+    ins.front()->metadata = { 0x01020304_size, 42u, true, false };
+    ins.back()->metadata = { 7u, 0x01020304_u32, false, true };
+
+    const compact_transaction instance{ tx };
+    BOOST_REQUIRE(instance.is_populated(0));
+    BOOST_REQUIRE(!instance.is_populated(1));
+
+    const auto first = instance.metadata(0);
+    BOOST_REQUIRE_EQUAL(first.height, 0x01020304_size);
+    BOOST_REQUIRE_EQUAL(first.median_time_past, 42u);
+    BOOST_REQUIRE(first.spent);
+    BOOST_REQUIRE(!first.coinbase);
+
+    const auto copy = instance.to_transaction();
+    const auto& metadata = copy.inputs_ptr()->back()->metadata;
+    BOOST_REQUIRE_EQUAL(metadata.height, 7u);
+    BOOST_REQUIRE_EQUAL(metadata.median_time_past, 0x01020304_u32);
+    BOOST_REQUIRE(!metadata.spent);
+    BOOST_REQUIRE(metadata.coinbase);
+    BOOST_REQUIRE_EQUAL(copy.inputs_ptr()->front()->metadata.height,
+        0x01020304_size);
+    BOOST_REQUIRE(compact_transaction{ copy } == instance);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -248,6 +248,12 @@ BOOST_AUTO_TEST_CASE(header__proof__genesis_block__expected)
     BOOST_REQUIRE_EQUAL(block.header().proof(), 0x0000000100010001);
 }
 
+BOOST_AUTO_TEST_CASE(header__proof_fixed__genesis_block__expected)
+{
+    const chain::block block{ settings(selection::mainnet).genesis_block };
+    BOOST_REQUIRE(chain::header::proof_fixed(block.header().bits()) == uint256{ 0x0000000100010001 });
+}
+
 // validation (public)
 // ----------------------------------------------------------------------------
 
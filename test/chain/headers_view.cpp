@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(headers_view_tests)
+
+using namespace system::chain;
+
+constexpr auto header1 = base16_array("010000006fe28c0ab6f1b372c1a6a246ae63f74f931e8365e15a089c68d6190000000000982051fd1e4ba744bbbe680e1fee14677ba1a3c3540bf7b1cdb606e857233e0e61bc6649ffff001d01e36299");
+constexpr uint32_t limit_seconds = 7200;
+constexpr uint32_t work_limit = 0x1d00ffff;
+
+// Litecoin header (scrypt proof of work), previous is scrypt_previous.
+static data_chunk scrypt_header() NOEXCEPT
+{
+    return header
+    {
+        536870912,
+        base16_hash("313ced849aafeff324073bb2bd31ecdcc365ed215a34e827bb797ad33d158542"),
+        base16_hash("5163359dde15eb3f49cbd0926981f065ef1405fc9d4cece8818662b3b65f5dc6"),
+        1535119178,
+        436332170,
+        2135224651
+    }.to_data();
+}
+
+static const auto scrypt_previous = base16_hash("313ced849aafeff324073bb2bd31ecdcc365ed215a34e827bb797ad33d158542");
+
+static data_chunk mainnet_headers() NOEXCEPT
+{
+    const auto genesis = settings(selection::mainnet).genesis_block.header();
+    return splice(genesis.to_data(), header1);
+}
+
+BOOST_AUTO_TEST_CASE(headers_view__constructor__default__valid_empty)
+{
+    const headers_view instance{};
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE(instance.hashes().empty());
+    BOOST_REQUIRE(instance.to_headers().empty());
+}
+
+BOOST_AUTO_TEST_CASE(headers_view__constructor__partial_header__invalid)
+{
+    const auto data = mainnet_headers();
+    const headers_view instance{ { data.begin(), std::prev(data.end()) } };
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.size(), zero);
+
+    code ec{};
+    BOOST_REQUIRE_EQUAL(instance.check(ec, null_hash, limit_seconds, work_limit), zero);
+    BOOST_REQUIRE_EQUAL(ec, error::orphan_block);
+}
+
+BOOST_AUTO_TEST_CASE(headers_view__hashes__mainnet__expected)
+{
+    const auto data = mainnet_headers();
+    const headers_view instance{ data };
+    BOOST_REQUIRE_EQUAL(instance.size(), two);
+
+    const auto hashes = instance.hashes();
+    BOOST_REQUIRE_EQUAL(hashes.size(), two);
+    BOOST_REQUIRE_EQUAL(hashes.front(), instance.header(0).hash());
+    BOOST_REQUIRE_EQUAL(hashes.back(), header{ header1 }.hash());
+    BOOST_REQUIRE_EQUAL(hashes.front(), header{ header1 }.previous_block_hash());
+}
+
+BOOST_AUTO_TEST_CASE(headers_view__to_headers__mainnet__hashes_cached)
+{
+    const auto data = mainnet_headers();
+    const auto headers = headers_view{ data }.to_headers();
+    BOOST_REQUIRE_EQUAL(headers.size(), two);
+    BOOST_REQUIRE(headers.back() == header{ header1 });
+    BOOST_REQUIRE_EQUAL(headers.back().get_hash(), header{ header1 }.hash());
+}
+
+BOOST_AUTO_TEST_CASE(headers_view__check__mainnet__success)
+{
+    const auto data = mainnet_headers();
+    const headers_view instance{ data };
+
+    code ec{};
+    BOOST_REQUIRE_EQUAL(instance.check(ec, null_hash, limit_seconds, work_limit), two);
+    BOOST_REQUIRE_EQUAL(ec, error::block_success);
+}
+
+BOOST_AUTO_TEST_CASE(headers_view__check__wrong_previous__orphan_block)
+{
+    const auto data = mainnet_headers();
+    const headers_view instance{ data };
+
+    code ec{};
+    BOOST_REQUIRE_EQUAL(instance.check(ec, one_hash, limit_seconds, work_limit), zero);
+    BOOST_REQUIRE_EQUAL(ec, error::orphan_block);
+}
+
+BOOST_AUTO_TEST_CASE(headers_view__check__unlinked__orphan_block)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block.header();
+    const auto data = splice(header1, genesis.to_data());
+    const headers_view instance{ data };
+
+    code ec{};
+    const auto previous = header{ header1 }.previous_block_hash();
+    BOOST_REQUIRE_EQUAL(instance.check(ec, previous, limit_seconds, work_limit), one);
+    BOOST_REQUIRE_EQUAL(ec, error::orphan_block);
+}
+
+BOOST_AUTO_TEST_CASE(headers_view__check__invalid_nonce__invalid_proof_of_work)
+{
+    auto data = mainnet_headers();
+    data.back() ^= 0x01;
+    const headers_view instance{ data };
+
+    code ec{};
+    BOOST_REQUIRE_EQUAL(instance.check(ec, null_hash, limit_seconds, work_limit), one);
+    BOOST_REQUIRE_EQUAL(ec, error::invalid_proof_of_work);
+}
+
+BOOST_AUTO_TEST_CASE(headers_view__check__excess_target__invalid_proof_of_work)
+{
+    const auto data = mainnet_headers();
+    const headers_view instance{ data };
+
+    // Headers bits exceed a proof of work limit lower than mainnet.
+    code ec{};
+    BOOST_REQUIRE_EQUAL(instance.check(ec, null_hash, limit_seconds, 0x1c00ffff), zero);
+    BOOST_REQUIRE_EQUAL(ec, error::invalid_proof_of_work);
+}
+
+BOOST_AUTO_TEST_CASE(headers_view__check__scrypt__success)
+{
+    const auto data = scrypt_header();
+    const headers_view instance{ data };
+
+    code ec{};
+    BOOST_REQUIRE_EQUAL(instance.check(ec, scrypt_previous, limit_seconds, work_limit, true), one);
+    BOOST_REQUIRE_EQUAL(ec, error::block_success);
+    BOOST_REQUIRE_EQUAL(instance.check(ec, scrypt_previous, limit_seconds, work_limit, false), zero);
+    BOOST_REQUIRE_EQUAL(ec, error::invalid_proof_of_work);
+}
+
+BOOST_AUTO_TEST_CASE(headers_view__check__scrypt_unlinked__orphan_block)
+{
+    const auto header = scrypt_header();
+    const auto data = splice(header, header);
+    const headers_view instance{ data };
+
+    code ec{};
+    BOOST_REQUIRE_EQUAL(instance.check(ec, scrypt_previous, limit_seconds, work_limit, true), one);
+    BOOST_REQUIRE_EQUAL(ec, error::orphan_block);
+}
+
+BOOST_AUTO_TEST_CASE(headers_view__check__scrypt_invalid_nonce_unlinked__invalid_proof_of_work)
+{
+    auto header = scrypt_header();
+    header.back() ^= 0x01;
+    const auto data = splice(header, header);
+    const headers_view instance{ data };
+
+    // Proof of work of the linked prefix precedes the linkage failure.
+    code ec{};
+    BOOST_REQUIRE_EQUAL(instance.check(ec, scrypt_previous, limit_seconds, work_limit, true), zero);
+    BOOST_REQUIRE_EQUAL(ec, error::invalid_proof_of_work);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(history_tests)
+
+using namespace system::chain;
+
+static std::vector<uint32_t> to_vector(const history& instance)
+{
+    return { instance.begin(), instance.end() };
+}
+
+BOOST_AUTO_TEST_CASE(history__constructor__default__empty)
+{
+    const history instance{};
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), zero);
+    BOOST_REQUIRE(instance.begin() == instance.end());
+}
+
+BOOST_AUTO_TEST_CASE(history__push_back__values__ordered)
+{
+    history instance{};
+    for (uint32_t value = 0; value < 100; ++value)
+        instance.push_back(value);
+
+    BOOST_REQUIRE_EQUAL(instance.size(), 100u);
+    BOOST_REQUIRE_EQUAL(instance.front(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.back(), 99u);
+    BOOST_REQUIRE_EQUAL(*std::next(instance.crbegin()), 98u);
+
+    uint32_t expected = 0;
+    for (const auto value: instance)
+        BOOST_REQUIRE_EQUAL(value, expected++);
+}
+
+BOOST_AUTO_TEST_CASE(history__pop_front__bounded_window__expected)
+{
+    history instance{};
+    for (uint32_t value = 0; value < 1000; ++value)
+    {
+        instance.push_back(value);
+        if (instance.size() > 11u)
+            instance.pop_front();
+    }
+
+    BOOST_REQUIRE_EQUAL(instance.size(), 11u);
+    BOOST_REQUIRE_EQUAL(instance.front(), 989u);
+    BOOST_REQUIRE_EQUAL(instance.back(), 999u);
+}
+
+BOOST_AUTO_TEST_CASE(history__push_back__child__parent_unchanged)
+{
+    history parent{};
+    parent.push_back(1);
+    parent.push_back(2);
+
+    auto child = parent;
+    child.push_back(3);
+    child.pop_front();
+
+    BOOST_REQUIRE_EQUAL(to_vector(parent), (std::vector<uint32_t>{ 1, 2 }));
+    BOOST_REQUIRE_EQUAL(to_vector(child), (std::vector<uint32_t>{ 2, 3 }));
+
+    // The newest window appends in place.
+    BOOST_REQUIRE(std::next(parent.begin()) == child.begin());
+}
+
+BOOST_AUTO_TEST_CASE(history__push_back__fork__siblings_independent)
+{
+    history parent{};
+    parent.push_back(1);
+    parent.push_back(2);
+
+    auto left = parent;
+    auto right = parent;
+    left.push_back(3);
+    right.push_back(4);
+
+    BOOST_REQUIRE_EQUAL(to_vector(parent), (std::vector<uint32_t>{ 1, 2 }));
+    BOOST_REQUIRE_EQUAL(to_vector(left), (std::vector<uint32_t>{ 1, 2, 3 }));
+    BOOST_REQUIRE_EQUAL(to_vector(right), (std::vector<uint32_t>{ 1, 2, 4 }));
+
+    // Appending to the parent is also a fork.
+    parent.push_back(5);
+    BOOST_REQUIRE_EQUAL(to_vector(parent), (std::vector<uint32_t>{ 1, 2, 5 }));
+    BOOST_REQUIRE_EQUAL(to_vector(left), (std::vector<uint32_t>{ 1, 2, 3 }));
+}
+
+BOOST_AUTO_TEST_CASE(history__push_back__chained_children__all_preserved)
+{
+    std::vector<history> states{ history{} };
+    for (uint32_t value = 0; value < 100; ++value)
+    {
+        auto child = states.back();
+        child.push_back(value);
+        if (child.size() > 10u)
+            child.pop_front();
+
+        states.push_back(std::move(child));
+    }
+
+    for (size_t height = 1; height < states.size(); ++height)
+    {
+        const auto& state = states.at(height);
+        const auto expected = static_cast<uint32_t>(sub1(height));
+        BOOST_REQUIRE_EQUAL(state.back(), expected);
+        BOOST_REQUIRE_EQUAL(state.size(), std::min(height, size_t{ 10 }));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(history__equality__same_values__true)
+{
+    history left{};
+    history right{};
+    left.push_back(0);
+    left.push_back(42);
+    left.pop_front();
+    right.push_back(42);
+    BOOST_REQUIRE(left == right);
+
+    right.push_back(7);
+    BOOST_REQUIRE(left != right);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -144,6 +144,12 @@ public:
     {
         return interpreter<contiguous_stack>::connect(ctx, *this, index);
     }
+
+    code connect_input(const context& ctx, uint32_t index) const NOEXCEPT
+    {
+        return transaction::connect_input(ctx,
+            std::next(inputs_ptr()->begin(), index));
+    }
 };
 
 transaction_accessor test_tx(const script_test& test)
@@ -594,6 +600,28 @@ BOOST_AUTO_TEST_CASE(script__context_free__invalid)
     }
 }
 
+BOOST_AUTO_TEST_CASE(script__connect_input__script_tests__matches_interpreter)
+{
+    for (const auto list:
+    {
+        &valid_bip16_scripts, &invalidated_bip16_scripts,
+        &valid_bip65_scripts, &invalid_bip65_scripts,
+        &invalidated_bip65_scripts, &valid_multisig_scripts,
+        &invalid_multisig_scripts, &valid_context_free_scripts,
+        &invalid_context_free_scripts
+    })
+    {
+        for (const auto& test: *list)
+        {
+            const auto tx = test_tx(test);
+            const auto name = test_name(test);
+            BOOST_REQUIRE_MESSAGE(tx.is_valid(), name);
+            BOOST_CHECK_MESSAGE(tx.connect_input({ flags::no_rules }, 0) == tx.connect({ flags::no_rules }, 0), name);
+            BOOST_CHECK_MESSAGE(tx.connect_input({ flags::all_rules }, 0) == tx.connect({ flags::all_rules }, 0), name);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(script__parse__not_invalid)
 {
     for (const auto& test: not_invalid_parse_scripts)
@@ -853,6 +881,12 @@ BOOST_AUTO_TEST_CASE(script__verify__bip143_native_p2wpkh_tx__success)
 
     // missing bip141 (witness not allowed).
     BOOST_REQUIRE_EQUAL(tx.connect({ flags::no_rules }, 1), error::unexpected_witness);
+
+    // Template fast path (p2wpkh) matches interpretation.
+    BOOST_REQUIRE_EQUAL(tx.connect_input({ flags::bip141_rule | flags::bip143_rule }, 1), error::script_success);
+    BOOST_REQUIRE_EQUAL(tx.connect_input({ flags::bip141_rule }, 1), error::stack_false);
+    BOOST_REQUIRE_EQUAL(tx.connect_input({ flags::bip143_rule }, 1), error::unexpected_witness);
+    BOOST_REQUIRE_EQUAL(tx.connect_input({ flags::no_rules }, 1), error::unexpected_witness);
 }
 
 BOOST_AUTO_TEST_CASE(script__verify__bip143_p2sh_p2wpkh_tx__success)
@@ -879,6 +913,12 @@ BOOST_AUTO_TEST_CASE(script__verify__bip143_p2sh_p2wpkh_tx__success)
 
     // missing bip143 (invalid sighash).
     BOOST_REQUIRE_EQUAL(tx.connect({ flags::bip16_rule | flags::bip141_rule }, 0), error::stack_false);
+
+    // Template fast path (p2sh-p2wpkh) matches interpretation.
+    BOOST_REQUIRE_EQUAL(tx.connect_input({ flags::bip16_rule | flags::bip141_rule | flags::bip143_rule }, 0), error::script_success);
+    BOOST_REQUIRE_EQUAL(tx.connect_input({ flags::bip141_rule | flags::bip143_rule }, 0), error::unexpected_witness);
+    BOOST_REQUIRE_EQUAL(tx.connect_input({ flags::bip16_rule | flags::bip143_rule }, 0), error::unexpected_witness);
+    BOOST_REQUIRE_EQUAL(tx.connect_input({ flags::bip16_rule | flags::bip141_rule }, 0), error::stack_false);
 }
 
 BOOST_AUTO_TEST_CASE(script__verify__bip143_native_p2wsh_1_tx__success)
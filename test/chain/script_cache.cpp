@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(script_cache_tests)
+
+using namespace system::chain;
+
+constexpr auto hash1 = base16_hash("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+constexpr auto hash2 = base16_hash("4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b");
+
+BOOST_AUTO_TEST_CASE(script_cache__construct__capacity__empty)
+{
+    const script_cache instance{ 42 };
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 42u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__find__empty__false_miss)
+{
+    const script_cache instance{ 42 };
+    BOOST_REQUIRE(!instance.find(hash1, 0, 0));
+    BOOST_REQUIRE_EQUAL(instance.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__find__stored__true_hit)
+{
+    script_cache instance{ 42 };
+    instance.store(hash1, 1, 2);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE(instance.find(hash1, 1, 2));
+    BOOST_REQUIRE_EQUAL(instance.hits(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__find__distinct_key_elements__false)
+{
+    script_cache instance{ 42 };
+    instance.store(hash1, 1, 2);
+    BOOST_REQUIRE(!instance.find(hash2, 1, 2));
+    BOOST_REQUIRE(!instance.find(hash1, 0, 2));
+    BOOST_REQUIRE(!instance.find(hash1, 1, 3));
+    BOOST_REQUIRE_EQUAL(instance.misses(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__store__duplicate__single_entry)
+{
+    script_cache instance{ 42 };
+    instance.store(hash1, 1, 2);
+    instance.store(hash1, 1, 2);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__store__zero_capacity__not_stored)
+{
+    script_cache instance{ 0 };
+    instance.store(hash1, 1, 2);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(!instance.find(hash1, 1, 2));
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__store__over_capacity__evicts_oldest)
+{
+    script_cache instance{ 2 };
+    instance.store(hash1, 0, 0);
+    instance.store(hash1, 1, 0);
+    instance.store(hash1, 2, 0);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE(!instance.find(hash1, 0, 0));
+    BOOST_REQUIRE(instance.find(hash1, 1, 0));
+    BOOST_REQUIRE(instance.find(hash1, 2, 0));
+
+    instance.store(hash1, 3, 0);
+    instance.store(hash1, 4, 0);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE(instance.find(hash1, 3, 0));
+    BOOST_REQUIRE(instance.find(hash1, 4, 0));
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__clear__stored__empty_counters_retained)
+{
+    script_cache instance{ 42 };
+    instance.store(hash1, 1, 2);
+    BOOST_REQUIRE(instance.find(hash1, 1, 2));
+    instance.clear();
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(!instance.find(hash1, 1, 2));
+    BOOST_REQUIRE_EQUAL(instance.hits(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__transaction_connect__repeated__cached)
+{
+    const transaction tx
+    {
+        1,
+        inputs{ { point{ hash1, 0 }, script{}, 0 }, { point{ hash1, 1 }, script{}, 0 } },
+        outputs{ {} },
+        0
+    };
+
+    const auto pass = to_shared<output>(0_u64, script{ { opcode::push_positive_1 } });
+    for (const auto& in: *tx.inputs_ptr())
+        in->prevout = pass;
+
+    script_cache cache{ 42 };
+    BOOST_REQUIRE(!tx.connect({}, cache));
+    BOOST_REQUIRE_EQUAL(cache.size(), 2u);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 2u);
+
+    BOOST_REQUIRE(!tx.connect({}, cache));
+    BOOST_REQUIRE_EQUAL(cache.hits(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__transaction_connect__failure__not_cached)
+{
+    const transaction tx
+    {
+        1,
+        inputs{ { point{ hash1, 0 }, script{}, 0 }, { point{ hash1, 1 }, script{}, 0 } },
+        outputs{ {} },
+        0
+    };
+
+    const auto& ins = *tx.inputs_ptr();
+    ins.front()->prevout = to_shared<output>(0_u64, script{ { opcode::push_positive_1 } });
+    ins.back()->prevout = to_shared<output>(0_u64, script{ { opcode::push_size_0 } });
+
+    script_cache cache{ 42 };
+    BOOST_REQUIRE_EQUAL(tx.connect({}, cache), error::stack_false);
+    BOOST_REQUIRE_EQUAL(cache.size(), 1u);
+    BOOST_REQUIRE(cache.find(tx.hash(true), 0, 0));
+    BOOST_REQUIRE(!cache.find(tx.hash(true), 1, 0));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
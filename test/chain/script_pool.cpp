@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(script_pool_tests)
+
+using namespace system::chain;
+
+// Size-prefixed p2pkh scripts (25 bytes) and a p2wpkh witness.
+const auto script1 = base16_chunk("1976a914fc7b44566256621affb1541cc9d59f08336d276b88ac");
+const auto script2 = base16_chunk("1976a914b9a2c9700ff9519516b21af338d28d53ddf5349388ac");
+const auto witness1 = base16_chunk("0203abcdef0201ff");
+
+static script::cptr intern_script(script_pool& pool, const data_chunk& data)
+{
+    read::bytes::copy source(data);
+    const auto out = pool.intern_script(source);
+    BOOST_REQUIRE(source);
+    return out;
+}
+
+static witness::cptr intern_witness(script_pool& pool, const data_chunk& data)
+{
+    read::bytes::copy source(data);
+    const auto out = pool.intern_witness(source);
+    BOOST_REQUIRE(source);
+    return out;
+}
+
+// Pooled bytes of a size-prefixed (single byte) script.
+static size_t footprint(const data_chunk& data)
+{
+    const data_chunk key(std::next(data.begin()), data.end());
+    return script_pool::footprint(key, script{ key, false });
+}
+
+BOOST_AUTO_TEST_CASE(script_pool__construct__capacity__empty)
+{
+    const script_pool instance{ 42 };
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 42u);
+    BOOST_REQUIRE_EQUAL(instance.limit(), 42u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.bytes(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(script_pool__construct__default_limit__expected)
+{
+    const script_pool instance{ 4242 };
+    BOOST_REQUIRE_EQUAL(instance.limit(), script_pool::default_limit);
+}
+
+BOOST_AUTO_TEST_CASE(script_pool__footprint__script__exceeds_key)
+{
+    const data_chunk key(std::next(script1.begin()), script1.end());
+    const script instance{ key, false };
+    BOOST_REQUIRE_GT(script_pool::footprint(key, instance), key.size() +
+        sizeof(script) + instance.ops().size() * sizeof(operation));
+    BOOST_REQUIRE_EQUAL(footprint(script1), footprint(script2));
+}
+
+BOOST_AUTO_TEST_CASE(script_pool__footprint__witness__exceeds_key)
+{
+    const witness instance{ witness1, true };
+    BOOST_REQUIRE_GT(script_pool::footprint(witness1, instance),
+        witness1.size() + sizeof(witness) + two * sizeof(data_chunk));
+}
+
+BOOST_AUTO_TEST_CASE(script_pool__intern_script__duplicate__shared_hit)
+{
+    script_pool instance{ 10000 };
+    const auto first = intern_script(instance, script1);
+    const auto second = intern_script(instance, script1);
+    BOOST_REQUIRE(first == second);
+    BOOST_REQUIRE(first->is_valid());
+    BOOST_REQUIRE_EQUAL(first->to_data(true), script1);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.bytes(), footprint(script1));
+    BOOST_REQUIRE_EQUAL(instance.hits(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(script_pool__intern_script__distinct__not_shared)
+{
+    script_pool instance{ 10000 };
+    const auto first = intern_script(instance, script1);
+    const auto second = intern_script(instance, script2);
+    BOOST_REQUIRE(first != second);
+    BOOST_REQUIRE_EQUAL(second->to_data(true), script2);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(script_pool__intern_script__over_limit__not_pooled)
+{
+    script_pool instance{ 10000, 24 };
+    const auto first = intern_script(instance, script1);
+    const auto second = intern_script(instance, script1);
+    BOOST_REQUIRE(first != second);
+    BOOST_REQUIRE(*first == *second);
+    BOOST_REQUIRE_EQUAL(first->to_data(true), script1);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(script_pool__intern_script__truncated__invalid_source)
+{
+    script_pool instance{ 10000 };
+    const data_chunk truncated(script1.begin(), std::prev(script1.end()));
+    read::bytes::copy source(truncated);
+    BOOST_REQUIRE(!instance.intern_script(source)->is_valid());
+    BOOST_REQUIRE(!source);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(script_pool__intern_script__over_capacity__oldest_evicted)
+{
+    const auto script3 = base16_chunk("0151");
+    script_pool instance{ footprint(script1) + footprint(script2) };
+    const auto first = intern_script(instance, script1);
+    intern_script(instance, script2);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.bytes(), footprint(script1) + footprint(script2));
+
+    // Evicts script1, which remains valid for its holder.
+    intern_script(instance, script3);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.bytes(), footprint(script2) + footprint(script3));
+    BOOST_REQUIRE(intern_script(instance, script1) != first);
+    BOOST_REQUIRE_EQUAL(first->to_data(true), script1);
+}
+
+BOOST_AUTO_TEST_CASE(script_pool__intern_script__zero_capacity__not_pooled)
+{
+    script_pool instance{ 0 };
+    const auto first = intern_script(instance, script1);
+    BOOST_REQUIRE(first != intern_script(instance, script1));
+    BOOST_REQUIRE_EQUAL(first->to_data(true), script1);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(script_pool__intern_witness__duplicate__shared_hit)
+{
+    script_pool instance{ 10000 };
+    const auto first = intern_witness(instance, witness1);
+    const auto second = intern_witness(instance, witness1);
+    BOOST_REQUIRE(first == second);
+    BOOST_REQUIRE_EQUAL(first->to_data(true), witness1);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.bytes(),
+        script_pool::footprint(witness1, witness{ witness1, true }));
+    BOOST_REQUIRE_EQUAL(instance.hits(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(script_pool__intern_witness__over_limit__not_pooled)
+{
+    script_pool instance{ 10000, 7 };
+    const auto first = intern_witness(instance, witness1);
+    const auto second = intern_witness(instance, witness1);
+    BOOST_REQUIRE(first != second);
+    BOOST_REQUIRE(*first == *second);
+    BOOST_REQUIRE_EQUAL(first->to_data(true), witness1);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(script_pool__intern_witness__truncated__invalid_source)
+{
+    script_pool instance{ 10000 };
+    const data_chunk truncated(witness1.begin(), std::prev(witness1.end()));
+    read::bytes::copy source(truncated);
+    BOOST_REQUIRE(!instance.intern_witness(source)->is_valid());
+    BOOST_REQUIRE(!source);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(script_pool__clear__pooled__empty_counters_retained)
+{
+    script_pool instance{ 10000 };
+    intern_script(instance, script1);
+    intern_witness(instance, witness1);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    instance.clear();
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.bytes(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(script_pool__transaction__duplicate_outputs__shared_scripts)
+{
+    const script prevout{ script1, true };
+    const transaction instance
+    {
+        1,
+        inputs{ { point{ null_hash, 0 }, script{}, 0 } },
+        outputs{ { 1, prevout }, { 2, prevout } },
+        0
+    };
+
+    const auto data = instance.to_data(true);
+    script_pool pool{ 10000 };
+    read::bytes::copy source(data);
+    const transaction pooled{ source, true, pool };
+    BOOST_REQUIRE(pooled.is_valid());
+    BOOST_REQUIRE(pooled == instance);
+
+    const auto& outs = *pooled.outputs_ptr();
+    BOOST_REQUIRE(outs.front()->script_ptr() == outs.back()->script_ptr());
+    BOOST_REQUIRE_EQUAL(pool.hits(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -276,6 +276,37 @@ BOOST_AUTO_TEST_CASE(transaction__constructor___fast_2__success)
     BOOST_REQUIRE_EQUAL(tx.serialized_size(true), tx2_data.size());
 }
 
+BOOST_AUTO_TEST_CASE(transaction__constructor__fast_reader_1__success)
+{
+    stream::in::fast stream(tx1_data);
+    read::bytes::fast source(stream);
+    const transaction tx(source, true);
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE(source);
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE_EQUAL(tx.hash(false), tx1_hash);
+    BOOST_REQUIRE_EQUAL(tx.to_data(true), tx1_data);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__fast_reader_2__success)
+{
+    stream::in::fast stream(tx2_data);
+    const transaction tx(read::bytes::fast(stream), true);
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE_EQUAL(tx.hash(false), tx2_hash);
+    BOOST_REQUIRE_EQUAL(tx.to_data(true), tx2_data);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__fast_reader_truncated__invalid)
+{
+    const data_chunk data{ tx1_data.begin(), std::prev(tx1_data.end()) };
+    stream::in::fast stream(data);
+    read::bytes::fast source(stream);
+    const transaction tx(source, true);
+    BOOST_REQUIRE(!tx.is_valid());
+    BOOST_REQUIRE(!source);
+}
+
 BOOST_AUTO_TEST_CASE(transaction__constructor__stream_1__success)
 {
     stream::in::copy stream(tx1_data);
@@ -746,7 +777,66 @@ BOOST_AUTO_TEST_CASE(transaction__signature_operations__empty_input_output__zero
 
 // check
 // accept
-// connect
+
+// Signed p2pkh spend, optionally invalidated by hash mutation after signing.
+static transaction p2pkh_spend(bool valid, const witness& extra={}) NOEXCEPT
+{
+    const ec_secret secret = base16_hash("ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333");
+    ec_compressed point;
+    secret_to_public(point, secret);
+
+    const script prevout_script{ script::to_pay_key_hash_pattern(bitcoin_short_hash(point)) };
+    const chain::point previous{ one_hash, 0 };
+    const outputs outs{ { 42, script{} } };
+    const transaction unsigned_tx{ 1, inputs{ { previous, script{}, max_uint32 } }, outs, 0 };
+
+    endorsement out;
+    unsigned_tx.create_endorsement(out, secret, prevout_script, 0, 0, coverage::hash_all, script_version::unversioned, false);
+
+    if (!valid)
+        out.at(10) ^= 0x01;
+
+    const script input_script{ { { out, false }, { to_chunk(point), false } } };
+    const transaction tx{ 1, inputs{ { previous, input_script, extra, max_uint32 } }, outs, 0 };
+    tx.inputs_ptr()->front()->prevout = to_shared<output>(0_u64, prevout_script);
+    return tx;
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__p2pkh_valid__success)
+{
+    const auto tx = p2pkh_spend(true);
+    BOOST_REQUIRE(!tx.connect({}));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__p2pkh_invalid__stack_false)
+{
+    const auto tx = p2pkh_spend(false);
+    BOOST_REQUIRE_EQUAL(tx.connect({}), error::stack_false);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__p2pkh_valid_witnessed__unexpected_witness)
+{
+    const auto tx = p2pkh_spend(true, witness{ data_stack{ { 0x42 } } });
+    BOOST_REQUIRE_EQUAL(tx.connect({}), error::unexpected_witness);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__batch_p2pkh_valid__deferred)
+{
+    const auto tx = p2pkh_spend(true);
+    signature_batch batch{};
+    BOOST_REQUIRE(!tx.connect({}, batch));
+    BOOST_REQUIRE_EQUAL(batch.size(), 1u);
+    BOOST_REQUIRE_EQUAL(verify_signatures(batch), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__batch_p2pkh_invalid__deferred_failure)
+{
+    const auto tx = p2pkh_spend(false);
+    signature_batch batch{};
+    BOOST_REQUIRE(!tx.connect({}, batch));
+    BOOST_REQUIRE_EQUAL(batch.size(), 1u);
+    BOOST_REQUIRE_EQUAL(verify_signatures(batch), 0u);
+}
 
 // validation (protected)
 // ----------------------------------------------------------------------------
@@ -1491,6 +1581,276 @@ BOOST_AUTO_TEST_CASE(transaction__signature_hash__all__expected)
     BOOST_REQUIRE_EQUAL(sighash, expected);
 }
 
+BOOST_AUTO_TEST_CASE(transaction__signature_hash__unversioned_cached__expected)
+{
+    // Inputs span several sha256 blocks, with fewer outputs than inputs.
+    // Input scripts are not signed, but are required to initialize the cache.
+    inputs ins{};
+    for (uint32_t index = 0; index < 42; ++index)
+        ins.emplace_back(point{ sha256_hash(to_little_endian(index)), index },
+            script{ "0" }, add1(index));
+
+    const outputs outs
+    {
+        { 1, script{ "dup hash160 [88350574280395ad2c3e2ee20e322073d94e5e40] equalverify checksig" } },
+        { 2, script{ "return" } },
+        { 3, script{} }
+    };
+
+    const transaction instance{ 1, ins, outs, 42 };
+    const script sub{ "dup hash160 [88350574280395ad2c3e2ee20e322073d94e5e40] equalverify checksig" };
+    constexpr std::array<uint8_t, 8> flags
+    {
+        coverage::hash_all,
+        coverage::hash_none,
+        coverage::hash_single,
+        coverage::hash_all | coverage::anyone_can_pay,
+        coverage::hash_none | coverage::anyone_can_pay,
+        coverage::hash_single | coverage::anyone_can_pay,
+        0x00,
+        0x42
+    };
+
+    std::vector<hash_digest> expected{};
+    for (auto input = instance.inputs_ptr()->begin(); input != instance.inputs_ptr()->end(); ++input)
+        for (const auto flag: flags)
+            expected.push_back(instance.signature_hash(input, sub, 0, flag, script_version::unversioned, false));
+
+    instance.initialize_sighash_cache();
+
+    auto hash = expected.begin();
+    for (auto input = instance.inputs_ptr()->begin(); input != instance.inputs_ptr()->end(); ++input)
+        for (const auto flag: flags)
+            BOOST_REQUIRE_EQUAL(instance.signature_hash(input, sub, 0, flag, script_version::unversioned, false), *hash++);
+}
+
+// Taproot (bip341) spends of the bip340 test vector 1 key.
+const ec_secret taproot_secret = base16_array("b7e151628aed2a6abf7158809cf4f3c762e7160f38b4da56a784d9045190cfef");
+const std::string taproot_prevout{ "1 [dff1d77f2a671c5f36183726db2341be58feae1da2deced843240f7b502ba659]" };
+constexpr auto taproot_flags = flags::bip141_rule | flags::bip143_rule | flags::bip341_rule;
+
+static transaction taproot_tx(const witness& first, const witness& second,
+    bool populated=true) NOEXCEPT
+{
+    const inputs ins
+    {
+        { point{ base16_hash("0101010101010101010101010101010101010101010101010101010101010101"), 0 }, script{}, first, 0xfffffffd },
+        { point{ base16_hash("0202020202020202020202020202020202020202020202020202020202020202"), 1 }, script{}, second, 0xffffffff }
+    };
+
+    const outputs outs
+    {
+        { 150000, script{ "1 [0505050505050505050505050505050505050505050505050505050505050505]" } },
+        { 140000, script{ "return" } }
+    };
+
+    const transaction tx{ 2, ins, outs, 42 };
+    tx.inputs_ptr()->front()->prevout = to_shared<output>(100000u, script{ taproot_prevout });
+
+    if (populated)
+        tx.inputs_ptr()->back()->prevout = to_shared<output>(200000u, script{ taproot_prevout });
+
+    return tx;
+}
+
+static witness taproot_witness(const transaction& tx, uint32_t index) NOEXCEPT
+{
+    hash_digest hash{};
+    ec_signature signature{};
+    const auto input = std::next(tx.inputs_ptr()->begin(), index);
+    if (!tx.signature_hash(hash, input, coverage::hash_default) ||
+        !sign_schnorr(signature, taproot_secret, hash))
+        return {};
+
+    return { data_stack{ to_chunk(signature) } };
+}
+
+// bip341 keyPathSpending test vector (unsigned transaction and spent outputs).
+const auto bip341_tx = base16_chunk(
+    "02000000097de20cbff686da83a54981d2b9bab3586f4ca7e48f57f5b55963115f3b334e9c"
+    "010000000000000000d7b7cab57b1393ace2d064f4d4a2cb8af6def61273e127517d44759b"
+    "6dafdd990000000000fffffffff8e1f583384333689228c5d28eac13366be082dc57441760"
+    "d957275419a418420000000000fffffffff0689180aa63b30cb162a73c6d2a38b7eeda2a83"
+    "ece74310fda0843ad604853b0100000000feffffffaa5202bdf6d8ccd2ee0f0202afbbb746"
+    "1d9264a25e5bfd3c5a52ee1239e0ba6c0000000000feffffff956149bdc66faa968eb2be2d"
+    "2faa29718acbfe3941215893a2a3446d32acd050000000000000000000e664b9773b88c09c"
+    "32cb70a2a3e4da0ced63b7ba3b22f848531bbb1d5d5f4c94010000000000000000e9aa6b8e"
+    "6c9de67619e6a3924ae25696bb7b694bb677a632a74ef7eadfd4eabf0000000000ffffffff"
+    "a778eb6a263dc090464cd125c466b5a99667720b1c110468831d058aa1b82af10100000000"
+    "ffffffff0200ca9a3b000000001976a91406afd46bcdfd22ef94ac122aa11f241244a37ecc"
+    "88ac807840cb0000000020ac9a87f5594be208f8532db38cff670c450ed2fea8fcdefcc9a6"
+    "63f78bab962b0065cd1d");
+
+const std::vector<std::pair<uint64_t, data_chunk>> bip341_prevouts
+{
+    { 420000000, base16_chunk("512053a1f6e454df1aa2776a2814a721372d6258050de330b3c6d10ee8f4e0dda343") },
+    { 462000000, base16_chunk("5120147c9c57132f6e7ecddba9800bb0c4449251c92a1e60371ee77557b6620f3ea3") },
+    { 294000000, base16_chunk("76a914751e76e8199196d454941c45d1b3a323f1433bd688ac") },
+    { 504000000, base16_chunk("5120e4d810fd50586274face62b8a807eb9719cef49c04177cc6b76a9a4251d5450e") },
+    { 630000000, base16_chunk("512091b64d5324723a985170e4dc5a0f84c041804f2cd12660fa5dec09fc21783605") },
+    { 378000000, base16_chunk("00147dd65592d0ab2fe0d0257d571abf032cd9db93dc") },
+    { 672000000, base16_chunk("512075169f4001aa68f15bbed28b218df1d0a62cbbcf1188c6665110c293c907b831") },
+    { 546000000, base16_chunk("5120712447206d7a5238acc7ff53fbe94a3b64539ad291c7cdbc490b7577e4b17df5") },
+    { 588000000, base16_chunk("512077e30a5522dd9f894c3f8b8bd4c4b2cf82ca7da8a3ea6a239655c39c050ab220") }
+};
+
+static transaction bip341_transaction() NOEXCEPT
+{
+    const transaction tx{ bip341_tx, false };
+    auto prevout = bip341_prevouts.begin();
+    for (const auto& input: *tx.inputs_ptr())
+    {
+        input->prevout = to_shared<output>(prevout->first,
+            script{ prevout->second, false });
+        ++prevout;
+    }
+
+    return tx;
+}
+
+BOOST_AUTO_TEST_CASE(transaction__signature_hash__bip341_key_path_vectors__expected)
+{
+    const auto instance = bip341_transaction();
+    BOOST_REQUIRE(instance.is_valid());
+
+    const auto& ins = *instance.inputs_ptr();
+    const std::vector<std::tuple<uint32_t, uint8_t, hash_digest>> vectors
+    {
+        { 0, coverage::hash_single, base16_array("2514a6272f85cfa0f45eb907fcb0d121b808ed37c6ea160a5a9046ed5526d555") },
+        { 1, coverage::single_anyone_can_pay, base16_array("325a644af47e8a5a2591cda0ab0723978537318f10e6a63d4eed783b96a71a4d") },
+        { 3, coverage::hash_all, base16_array("bf013ea93474aa67815b1b6cc441d23b64fa310911d991e713cd34c7f5d46669") },
+        { 6, coverage::hash_none, base16_array("15f25c298eb5cdc7eb1d638dd2d45c97c4c59dcaec6679cfc16ad84f30876b85") },
+        { 7, coverage::none_anyone_can_pay, base16_array("cd292de50313804dabe4685e83f923d2969577191a3e1d2882220dca88cbeb10") },
+        { 8, coverage::all_anyone_can_pay, base16_array("cccb739eca6c13a8a89e6e5cd317ffe55669bbda23f2fd37b0f18755e008edd2") }
+    };
+
+    // Cached aggregates must not change the result.
+    for (auto cached = 0; cached < 2; ++cached)
+    {
+        if (to_bool(cached))
+            instance.initialize_sighash_cache();
+
+        for (const auto& [index, flags, expected]: vectors)
+        {
+            hash_digest hash{};
+            BOOST_REQUIRE(instance.signature_hash(hash, std::next(ins.begin(), index), flags));
+            BOOST_REQUIRE_EQUAL(hash, expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(transaction__signature_hash__version_1_annex__committed)
+{
+    const auto plain = taproot_tx(witness{ "[42]" }, witness{ "[42]" });
+    const auto annexed = taproot_tx(witness{ "[42] [50aa]" }, witness{ "[42]" });
+    const auto other = taproot_tx(witness{ "[42] [50bb]" }, witness{ "[42]" });
+
+    hash_digest plain_hash{};
+    hash_digest annexed_hash{};
+    hash_digest other_hash{};
+    BOOST_REQUIRE(plain.signature_hash(plain_hash, plain.inputs_ptr()->begin(), coverage::hash_default));
+    BOOST_REQUIRE(annexed.signature_hash(annexed_hash, annexed.inputs_ptr()->begin(), coverage::hash_default));
+    BOOST_REQUIRE(other.signature_hash(other_hash, other.inputs_ptr()->begin(), coverage::hash_default));
+    BOOST_REQUIRE_NE(annexed_hash, plain_hash);
+    BOOST_REQUIRE_NE(annexed_hash, other_hash);
+
+    // The annex of one input does not affect the signature hash of another.
+    BOOST_REQUIRE(plain.signature_hash(plain_hash, std::next(plain.inputs_ptr()->begin()), coverage::hash_default));
+    BOOST_REQUIRE(annexed.signature_hash(annexed_hash, std::next(annexed.inputs_ptr()->begin()), coverage::hash_default));
+    BOOST_REQUIRE_EQUAL(annexed_hash, plain_hash);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__signature_hash__version_1_invalid__false)
+{
+    hash_digest hash{};
+    const auto instance = taproot_tx(witness{ "[42]" }, witness{ "[42]" });
+    const auto input = instance.inputs_ptr()->begin();
+    BOOST_REQUIRE(!instance.signature_hash(hash, input, 0x04));
+    BOOST_REQUIRE(!instance.signature_hash(hash, input, coverage::anyone_can_pay));
+    BOOST_REQUIRE(!instance.signature_hash(hash, input, 0x84));
+
+    const auto unpopulated = taproot_tx(witness{ "[42]" }, witness{ "[42]" }, false);
+    BOOST_REQUIRE(!unpopulated.signature_hash(hash, unpopulated.inputs_ptr()->begin(), coverage::hash_all));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__taproot_key_path__expected)
+{
+    const auto unsigned_tx = taproot_tx(witness{ "[42]" }, witness{ "[42]" });
+    const auto first = taproot_witness(unsigned_tx, 0);
+    const auto second = taproot_witness(unsigned_tx, 1);
+    BOOST_REQUIRE_EQUAL(first.stack().size(), 1u);
+    BOOST_REQUIRE_EQUAL(second.stack().size(), 1u);
+
+    const auto instance = taproot_tx(first, second);
+    BOOST_REQUIRE_EQUAL(instance.connect({ taproot_flags }), error::transaction_success);
+
+    signature_batch batch{};
+    BOOST_REQUIRE_EQUAL(instance.connect({ taproot_flags }, batch), error::transaction_success);
+    BOOST_REQUIRE_EQUAL(batch.size(), 2u);
+    BOOST_REQUIRE_EQUAL(batch.front().point.size(), ec_xonly_size);
+    BOOST_REQUIRE_EQUAL(verify_signatures(batch), batch.size());
+
+    // The first signature does not sign the second input.
+    const auto invalid = taproot_tx(first, first);
+    BOOST_REQUIRE_EQUAL(invalid.connect({ taproot_flags }), error::invalid_taproot_signature);
+    BOOST_REQUIRE_EQUAL(invalid.connect({ taproot_flags & ~flags::bip341_rule }), error::transaction_success);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__batch_xonly_checksig__deferred_failure)
+{
+    // Legacy checksig of an x-only key, with a der encoded schnorr signature.
+    const script prevout_script{ "[dff1d77f2a671c5f36183726db2341be58feae1da2deced843240f7b502ba659] checksig" };
+    const outputs outs{ { 42, script{} } };
+    const transaction unsigned_tx{ 1, inputs{ { point{ null_hash, 0 }, script{}, max_uint32 } }, outs, 0 };
+    const auto hash = unsigned_tx.signature_hash(unsigned_tx.inputs_ptr()->begin(),
+        prevout_script, 0, coverage::hash_all, script_version::unversioned, false);
+
+    ec_signature signature{};
+    der_signature der{};
+    BOOST_REQUIRE(sign_schnorr(signature, taproot_secret, hash));
+    BOOST_REQUIRE(encode_signature(der, signature));
+    der.push_back(coverage::hash_all);
+
+    const script input_script{ { { der, false } } };
+    const transaction tx{ 1, inputs{ { point{ null_hash, 0 }, input_script, max_uint32 } }, outs, 0 };
+    tx.inputs_ptr()->front()->prevout = to_shared<output>(0_u64, prevout_script);
+    BOOST_REQUIRE_EQUAL(tx.connect({}), error::stack_false);
+
+    // The deferred entry is ecdsa, so it fails as it does when not deferred.
+    signature_batch batch{};
+    BOOST_REQUIRE(!tx.connect({}, batch));
+    BOOST_REQUIRE_EQUAL(batch.size(), 1u);
+    BOOST_REQUIRE(batch.front().kind == signature_kind::ecdsa);
+    BOOST_REQUIRE_EQUAL(verify_signatures(batch), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__taproot_script_path__unsupported_taproot_script)
+{
+    const auto spend = [](const std::string& stack) NOEXCEPT
+    {
+        const transaction tx
+        {
+            2,
+            inputs{ { point{ null_hash, 0 }, script{}, witness{ stack }, 0 } },
+            outputs{ { 0, script{ "return" } } },
+            0
+        };
+
+        tx.inputs_ptr()->front()->prevout = to_shared<output>(1u, script{ taproot_prevout });
+        return tx;
+    };
+
+    // Tapscript (bip342) is not implemented, so script path spends are rejected.
+    const std::string control{ "c1dff1d77f2a671c5f36183726db2341be58feae1da2deced843240f7b502ba659" };
+    BOOST_REQUIRE_EQUAL(spend("[51] [" + control + "]").connect({ taproot_flags }), error::unsupported_taproot_script);
+    BOOST_REQUIRE_EQUAL(spend("[51] [" + control + "] [50]").connect({ taproot_flags }), error::unsupported_taproot_script);
+    BOOST_REQUIRE_EQUAL(spend("[51] [" + control + "]").connect({ taproot_flags & ~flags::bip341_rule }), error::transaction_success);
+
+    // The incomplete rule is excluded from all_rules.
+    BOOST_REQUIRE(!script::is_enabled(flags::all_rules, flags::bip341_rule));
+    BOOST_REQUIRE_EQUAL(spend("[51] [" + control + "]").connect({ flags::all_rules }), error::transaction_success);
+}
+
 // json
 // ----------------------------------------------------------------------------
 
@@ -0,0 +1,214 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(transaction_view_tests)
+
+using namespace system::chain;
+
+static const auto tx_data = base16_chunk(
+    "0100000001f08e44a96bfb5ae63eda1a6620adae37ee37ee4777fb0336e1bbbc"
+    "4de65310fc010000006a473044022050d8368cacf9bf1b8fb1f7cfd9aff63294"
+    "789eb1760139e7ef41f083726dadc4022067796354aba8f2e02363c5e510aa7e"
+    "2830b115472fb31de67d16972867f13945012103e589480b2f746381fca01a9b"
+    "12c517b7a482a203c8b2742985da0ac72cc078f2ffffffff02f0c9c467000000"
+    "001976a914d9d78e26df4e4601cf9b26d09c7b280ee764469f88ac80c4600f00"
+    "0000001976a9141ee32412020a324b93b1a1acfdfff6ab9ca8fac288ac000000"
+    "00");
+
+// Script and witness text parsing is not safe for static initialization.
+static transaction segregated_tx() NOEXCEPT
+{
+    const inputs ins
+    {
+        {
+            point{ base16_hash("0102030405060708091011121314151617181920212223242526272829303132"), 7 },
+            script{},
+            witness{ "[424242] [0303030303]" },
+            0xfffffffe
+        },
+        {
+            point{ base16_hash("3132333435363738394041424344454647484950515253545556575859606162"), 0 },
+            script{ "[0011223344]" },
+            witness{},
+            42
+        }
+    };
+
+    const outputs outs
+    {
+        { 1234, script{ "0 [00112233445566778899aabbccddeeff00112233]" } },
+        { 5678, script{ "return" } }
+    };
+
+    return { 2, ins, outs, 9 };
+}
+
+static void check_equal(const transaction_view& view, const transaction& tx)
+{
+    BOOST_REQUIRE(view.is_valid());
+    BOOST_REQUIRE_EQUAL(view.is_segregated(), tx.is_segregated());
+    BOOST_REQUIRE_EQUAL(view.is_coinbase(), tx.is_coinbase());
+    BOOST_REQUIRE_EQUAL(view.version(), tx.version());
+    BOOST_REQUIRE_EQUAL(view.locktime(), tx.locktime());
+    BOOST_REQUIRE_EQUAL(view.serialized_size(false), tx.serialized_size(false));
+    BOOST_REQUIRE_EQUAL(view.serialized_size(true), tx.serialized_size(true));
+    BOOST_REQUIRE_EQUAL(view.hash(false), tx.hash(false));
+    BOOST_REQUIRE_EQUAL(view.hash(true), tx.hash(true));
+
+    const auto& ins = *tx.inputs_ptr();
+    BOOST_REQUIRE_EQUAL(view.inputs().size(), ins.size());
+
+    auto in = ins.begin();
+    for (const auto& input: view.inputs())
+    {
+        const auto& expected = **in++;
+        BOOST_REQUIRE(input.is_valid());
+        BOOST_REQUIRE(input.point() == expected.point());
+        BOOST_REQUIRE_EQUAL(input.point_index(), expected.point().index());
+        BOOST_REQUIRE_EQUAL(input.point_hash(), expected.point().hash());
+        BOOST_REQUIRE_EQUAL(input.script(), expected.script().to_data(false));
+        BOOST_REQUIRE_EQUAL(input.sequence(), expected.sequence());
+        BOOST_REQUIRE(input.to_input().point() == expected.point());
+    }
+
+    const auto& outs = *tx.outputs_ptr();
+    BOOST_REQUIRE_EQUAL(view.outputs().size(), outs.size());
+
+    auto out = outs.begin();
+    for (const auto& output: view.outputs())
+    {
+        const auto& expected = **out++;
+        BOOST_REQUIRE(output.is_valid());
+        BOOST_REQUIRE_EQUAL(output.value(), expected.value());
+        BOOST_REQUIRE_EQUAL(output.script(), expected.script().to_data(false));
+        BOOST_REQUIRE(output.to_output() == expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__constructor__default__invalid)
+{
+    const transaction_view instance{};
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.inputs().empty());
+    BOOST_REQUIRE(instance.outputs().empty());
+    BOOST_REQUIRE_EQUAL(instance.hash(false), null_hash);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__constructor__truncated__invalid)
+{
+    const data_chunk data{ tx_data.begin(), std::prev(tx_data.end()) };
+    const transaction_view instance{ data };
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.inputs().empty());
+    BOOST_REQUIRE(instance.outputs().empty());
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__constructor__unsegregated__expected)
+{
+    const transaction_view instance{ tx_data };
+    check_equal(instance, { tx_data, true });
+    BOOST_REQUIRE_EQUAL(instance.data(), tx_data);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__constructor__segregated__expected)
+{
+    const auto tx = segregated_tx();
+    const auto data = tx.to_data(true);
+    const transaction_view instance{ data };
+    BOOST_REQUIRE(instance.is_segregated());
+    check_equal(instance, tx);
+    BOOST_REQUIRE(instance.to_transaction(true) == tx);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__constructor__segregated_nominal__expected)
+{
+    const auto tx = segregated_tx();
+    const auto data = tx.to_data(false);
+    const transaction_view instance{ data };
+    BOOST_REQUIRE(!instance.is_segregated());
+    BOOST_REQUIRE_EQUAL(instance.hash(false), tx.hash(false));
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(true), data.size());
+    check_equal(instance, { data, true });
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__constructor__trailing_bytes__not_viewed)
+{
+    auto data = tx_data;
+    data.push_back(0x42);
+    const transaction_view instance{ data };
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(true), tx_data.size());
+    BOOST_REQUIRE_EQUAL(instance.data(), tx_data);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__constructor__300_inputs__expected)
+{
+    inputs ins{};
+    for (uint32_t index = 0; index < 300; ++index)
+        ins.emplace_back(point{ null_hash, index }, script{}, index);
+
+    const transaction tx{ 1, std::move(ins), outputs{ { 42, script{} } }, 0 };
+    const auto data = tx.to_data(true);
+    const transaction_view instance{ data };
+    check_equal(instance, tx);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__constructor__non_minimal_input_count__expected)
+{
+    // Input count of one encoded as a three byte variable integer.
+    auto data = tx_data;
+    const auto count = std::next(data.begin(), sizeof(uint32_t));
+    data.insert(data.erase(count), { 0xfd, 0x01, 0x00 });
+
+    const transaction_view instance{ data };
+    const transaction expected{ tx_data, true };
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.inputs().size(), one);
+    BOOST_REQUIRE(instance.inputs().begin()->point() == expected.inputs_ptr()->front()->point());
+    BOOST_REQUIRE_EQUAL(instance.inputs().begin()->script(), expected.inputs_ptr()->front()->script().to_data(false));
+    BOOST_REQUIRE_EQUAL(instance.outputs().size(), two);
+    BOOST_REQUIRE(instance.outputs().begin()->to_output() == *expected.outputs_ptr()->front());
+}
+
+BOOST_AUTO_TEST_CASE(transaction_view__to_transaction__unsegregated__expected)
+{
+    const transaction_view instance{ tx_data };
+    const transaction expected{ tx_data, true };
+    BOOST_REQUIRE(instance.to_transaction(true) == expected);
+    BOOST_REQUIRE(instance.to_transaction(false) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(input_view__constructor__default__invalid)
+{
+    const input_view instance{};
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.script().empty());
+    BOOST_REQUIRE_EQUAL(instance.point_index(), point::null_index);
+}
+
+BOOST_AUTO_TEST_CASE(output_view__constructor__default__invalid)
+{
+    const output_view instance{};
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.script().empty());
+    BOOST_REQUIRE_EQUAL(instance.value(), output::not_found);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
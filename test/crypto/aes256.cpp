@@ -54,4 +54,92 @@ BOOST_AUTO_TEST_CASE(encryption__aes256__nist__expected)
     BOOST_REQUIRE_EQUAL(block, plaintext);
 }
 
+// csrc.nist.gov/publications/detail/sp/800-38a/final (F.1.5, F.2.5, F.5.5)
+const auto sp800_key = base16_array("603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4");
+const auto sp800_plaintext = base16_chunk("6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e5130c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710");
+
+BOOST_AUTO_TEST_CASE(encryption__aes256__ecb_sp800__expected)
+{
+    const auto expected = base16_chunk("f3eed1bdb5d2a03c064b5a7e3db181f8591ccb10d410ed26dc5ba74a31362870b6ed21b99ca6f4f9f153e7b1beafed1d23304b7a39f9f3ff067d8d8f9e24ecc7");
+
+    auto bytes = sp800_plaintext;
+    BOOST_REQUIRE(aes256::encrypt_ecb(bytes, sp800_key));
+    BOOST_REQUIRE_EQUAL(bytes, expected);
+    BOOST_REQUIRE(aes256::decrypt_ecb(bytes, sp800_key));
+    BOOST_REQUIRE_EQUAL(bytes, sp800_plaintext);
+}
+
+BOOST_AUTO_TEST_CASE(encryption__aes256__cbc_sp800__expected)
+{
+    constexpr auto iv = base16_array("000102030405060708090a0b0c0d0e0f");
+    const auto expected = base16_chunk("f58c4c04d6e5f1ba779eabfb5f7bfbd69cfc4e967edb808d679f777bc6702c7d39f23369a9d9bacfa530e26304231461b2eb05e2c39be9fcda6c19078c6a9d1b");
+
+    auto bytes = sp800_plaintext;
+    BOOST_REQUIRE(aes256::encrypt_cbc(bytes, sp800_key, iv));
+    BOOST_REQUIRE_EQUAL(bytes, expected);
+    BOOST_REQUIRE(aes256::decrypt_cbc(bytes, sp800_key, iv));
+    BOOST_REQUIRE_EQUAL(bytes, sp800_plaintext);
+}
+
+BOOST_AUTO_TEST_CASE(encryption__aes256__ctr_sp800__expected)
+{
+    constexpr auto counter = base16_array("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff");
+    const auto expected = base16_chunk("601ec313775789a5b7a7f504bbf3d228f443e3ca4d62b59aca84e990cacaf5c52b0930daa23de94ce87017ba2d84988ddfc9c58db67aada613c2dd08457941a6");
+
+    auto bytes = sp800_plaintext;
+    aes256::encrypt_ctr(bytes, sp800_key, counter);
+    BOOST_REQUIRE_EQUAL(bytes, expected);
+    aes256::decrypt_ctr(bytes, sp800_key, counter);
+    BOOST_REQUIRE_EQUAL(bytes, sp800_plaintext);
+}
+
+BOOST_AUTO_TEST_CASE(encryption__aes256__ecb_cbc_partial_block__false_unchanged)
+{
+    constexpr aes256::block iv{};
+    const data_chunk expected(add1(aes256::block_size), 0x42);
+
+    auto bytes = expected;
+    BOOST_REQUIRE(!aes256::encrypt_ecb(bytes, sp800_key));
+    BOOST_REQUIRE(!aes256::decrypt_ecb(bytes, sp800_key));
+    BOOST_REQUIRE(!aes256::encrypt_cbc(bytes, sp800_key, iv));
+    BOOST_REQUIRE(!aes256::decrypt_cbc(bytes, sp800_key, iv));
+    BOOST_REQUIRE_EQUAL(bytes, expected);
+}
+
+BOOST_AUTO_TEST_CASE(encryption__aes256__ecb_pipelined__matches_single_block)
+{
+    // Spans multiple pipelines plus a remainder of single blocks.
+    constexpr auto count = 37_size;
+    data_chunk bytes(count * aes256::block_size);
+    for (size_t index = 0; index < bytes.size(); ++index)
+        bytes[index] = narrow_cast<uint8_t>(index);
+
+    auto expected = bytes;
+    for (size_t block = 0; block < count; ++block)
+        aes256::encrypt(unsafe_array_cast<uint8_t, aes256::block_size>(
+            std::next(expected.data(), block * aes256::block_size)), sp800_key);
+
+    const auto plaintext = bytes;
+    BOOST_REQUIRE(aes256::encrypt_ecb(bytes, sp800_key));
+    BOOST_REQUIRE_EQUAL(bytes, expected);
+    BOOST_REQUIRE(aes256::decrypt_ecb(bytes, sp800_key));
+    BOOST_REQUIRE_EQUAL(bytes, plaintext);
+}
+
+BOOST_AUTO_TEST_CASE(encryption__aes256__ctr_partial_block_counter_carry__round_trips)
+{
+    constexpr auto counter = base16_array("00000000000000000000fffffffffffe");
+    data_chunk bytes(37 * aes256::block_size + 5u, 0x5a);
+
+    // Key stream of the last (partial) block follows the carried counter.
+    aes256::block stream = base16_array("00000000000000000001000000000023");
+    aes256::encrypt(stream, sp800_key);
+
+    const auto plaintext = bytes;
+    aes256::encrypt_ctr(bytes, sp800_key, counter);
+    BOOST_REQUIRE_EQUAL(bytes.back(), stream[4] ^ 0x5a);
+    aes256::decrypt_ctr(bytes, sp800_key, counter);
+    BOOST_REQUIRE_EQUAL(bytes, plaintext);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -42,6 +42,38 @@ const der_signature der_signature3 = base16_chunk("3044022057d0b4fb0df5cefa245e7
 const ec_secret one = base16_array("0000000000000000000000000000000000000000000000000000000000000001");
 const ec_compressed generator_point_times_4 = base16_array("02e493dbf1c10d80f3581e4904930b1404cc6c13900ee0758474fa94abe8c4cd13");
 
+// bip340 test vectors
+const ec_secret schnorr_secret0 = base16_array("0000000000000000000000000000000000000000000000000000000000000003");
+const ec_xonly schnorr_point0 = base16_array("f9308a019258c31049344f85f89d5229b531c845836f99b08601f113bce036f9");
+const hash_digest schnorr_message0 = base16_array("0000000000000000000000000000000000000000000000000000000000000000");
+const ec_signature schnorr_signature0 = base16_array("e907831f80848d1069a5371b402410364bdf1c5f8307b0084c55f1ce2dca821525f66a4a85ea8b71e482a74f382d2ce5ebeee8fdb2172f477df4900d310536c0");
+const ec_secret schnorr_secret1 = base16_array("b7e151628aed2a6abf7158809cf4f3c762e7160f38b4da56a784d9045190cfef");
+const ec_xonly schnorr_point1 = base16_array("dff1d77f2a671c5f36183726db2341be58feae1da2deced843240f7b502ba659");
+const hash_digest schnorr_auxiliary1 = base16_array("0000000000000000000000000000000000000000000000000000000000000001");
+const hash_digest schnorr_message1 = base16_array("243f6a8885a308d313198a2e03707344a4093822299f31d0082efa98ec4e6c89");
+const ec_signature schnorr_signature1 = base16_array("6896bd60eeae296db48a229ff71dfe071bde413e6d43f917dc8dcf8c78de33418906d11ac976abccb20b091292bff4ea897efcb639ea871cfa95f6de339e4b0a");
+const ec_secret schnorr_secret2 = base16_array("c90fdaa22168c234c4c6628b80dc1cd129024e088a67cc74020bbea63b14e5c9");
+const ec_xonly schnorr_point2 = base16_array("dd308afec5777e13121fa72b9cc1b7cc0139715309b086c960e18fd969774eb8");
+const hash_digest schnorr_auxiliary2 = base16_array("c87aa53824b4d7ae2eb035a2b5bbbccc080e76cdc6d1692c4b0b62d798e6d906");
+const hash_digest schnorr_message2 = base16_array("7e2d58d8b3bcdf1abadec7829054f90dda9805aab56c77333024b9d0a508b75c");
+const ec_signature schnorr_signature2 = base16_array("5831aaeed7b44bb74e5eab94ba9d4294c49bcf2a60728d8b4c200f50dd313c1bab745879a5ad954a72c45a91c3a51d3c7adea98d82f8481e0e1e03674a6f3fb7");
+const ec_secret schnorr_secret3 = base16_array("0b432b2677937381aef05bb02a66ecd012773062cf3fa2549e44f58ed2401710");
+const ec_xonly schnorr_point3 = base16_array("25d1dff95105f5253c4022f628a996ad3a0d95fbf21d468a1b33f8c160d8f517");
+const hash_digest schnorr_auxiliary3 = base16_array("ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff");
+const hash_digest schnorr_message3 = base16_array("ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff");
+const ec_signature schnorr_signature3 = base16_array("7eb0509757e246f19449885651611cb965ecc1a187dd51b64fda1edc9637d5ec97582b9cb13db3933705b32ba982af5af25fd78881ebb32771fc5922efc66ea3");
+const ec_xonly schnorr_point4 = base16_array("d69c3509bb99e412e68b0fe8544e72837dfa30746d8be2aa65975f29d22dc7b9");
+const hash_digest schnorr_message4 = base16_array("4df3c3f68fcc83b27e9d42c90431a72499f17875c81a599b566c9889b9696703");
+const ec_signature schnorr_signature4 = base16_array("00000000000000000000003b78ce563f89a0ed9414f5aa28ad0d96d6795f9c6376afb1548af603b3eb45c9f8207dee1060cb71c04e80f593060b07d28308d7f4");
+
+// bip340 test vectors 5 (public key not on curve) and 6 (odd nonce point)
+const ec_xonly schnorr_point5 = base16_array("eefdea4cdb677750a420fee807eacf21eb9898ae79b9768766e4faa04a2d4a34");
+const ec_signature schnorr_signature5 = base16_array("6cff5c3ba86c69ea4b7376f31a9bcb4f74c1976089b2d9963da2e5543e17776969e89b4c5564d00349106b8497785dd7d1d713a8ae82b32fa79d5f7fc407d39b");
+const ec_signature schnorr_signature6 = base16_array("fff97bd5755eeea420453a14355235d382f6472f8568a18b2f057a14602975563cc27944640ac607cd107ae10923d9ef7a73c643e166be5ebeafa34b1ac553e2");
+
+// bip341 tweak of schnorr_point1 by tagged_hash("TapTweak", schnorr_point1)
+const ec_xonly tweaked_point1 = base16_array("7ad4375032c38eba4fc60deca75fa30a3a6bdf2fb38f7e617288e2d3776117cb");
+
 // constants
 
 BOOST_AUTO_TEST_CASE(elliptic_curve__generator__expected)
@@ -145,6 +177,175 @@ BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signature__negative__expected)
     BOOST_REQUIRE(!verify_signature(compressed2, sighash2, signature));
 }
 
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signature__cached__expected)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature2, false));
+
+    auto invalid = signature;
+    invalid[10] = 110;
+
+    set_signature_cache(1024);
+    BOOST_REQUIRE(verify_signature(compressed2, sighash2, signature));
+    BOOST_REQUIRE(verify_signature(compressed2, sighash2, signature));
+    BOOST_REQUIRE(!verify_signature(compressed2, sighash2, invalid));
+    BOOST_REQUIRE(!verify_signature(compressed2, sighash2, invalid));
+    BOOST_REQUIRE_EQUAL(verify_signatures({ { to_chunk(compressed2), sighash2, signature, signature_kind::ecdsa } }), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signatures__empty__zero)
+{
+    BOOST_REQUIRE_EQUAL(verify_signatures({}), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signatures__all_positive__size)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature2, false));
+
+    ec_compressed point;
+    BOOST_REQUIRE(secret_to_public(point, secret1));
+    const auto hash = bitcoin_hash(to_chunk("data"));
+
+    ec_signature signature1;
+    BOOST_REQUIRE(sign(signature1, secret1, hash));
+
+    const signature_batch batch
+    {
+        { to_chunk(compressed2), sighash2, signature, signature_kind::ecdsa },
+        { to_chunk(compressed2), sighash2, signature, signature_kind::ecdsa },
+        { to_chunk(point), hash, signature1, signature_kind::ecdsa }
+    };
+
+    BOOST_REQUIRE_EQUAL(verify_signatures(batch), batch.size());
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signatures__negative__first_failure_index)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature2, false));
+
+    auto invalid = signature;
+    invalid[10] = 110;
+
+    const signature_batch batch
+    {
+        { to_chunk(compressed2), sighash2, signature, signature_kind::ecdsa },
+        { to_chunk(compressed2), sighash2, invalid, signature_kind::ecdsa },
+        { to_chunk(compressed2), sighash2, signature, signature_kind::ecdsa },
+        { to_chunk(compressed2), sighash2, invalid, signature_kind::ecdsa }
+    };
+
+    BOOST_REQUIRE_EQUAL(verify_signatures(batch), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signatures__invalid_point__first_failure_index)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature2, false));
+
+    const signature_batch batch
+    {
+        { to_chunk(compressed2), sighash2, signature, signature_kind::ecdsa },
+        { to_chunk(null_ec_compressed), sighash2, signature, signature_kind::ecdsa }
+    };
+
+    BOOST_REQUIRE_EQUAL(verify_signatures(batch), 1u);
+}
+
+// schnorr
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__secret_to_xonly__bip340_vectors__expected)
+{
+    ec_xonly point;
+    BOOST_REQUIRE(secret_to_xonly(point, schnorr_secret0));
+    BOOST_REQUIRE_EQUAL(point, schnorr_point0);
+    BOOST_REQUIRE(secret_to_xonly(point, schnorr_secret1));
+    BOOST_REQUIRE_EQUAL(point, schnorr_point1);
+    BOOST_REQUIRE(secret_to_xonly(point, schnorr_secret2));
+    BOOST_REQUIRE_EQUAL(point, schnorr_point2);
+    BOOST_REQUIRE(secret_to_xonly(point, schnorr_secret3));
+    BOOST_REQUIRE_EQUAL(point, schnorr_point3);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__sign_schnorr__bip340_vectors__expected)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(sign_schnorr(signature, schnorr_secret0, schnorr_message0));
+    BOOST_REQUIRE_EQUAL(signature, schnorr_signature0);
+    BOOST_REQUIRE(sign_schnorr(signature, schnorr_secret1, schnorr_message1, schnorr_auxiliary1));
+    BOOST_REQUIRE_EQUAL(signature, schnorr_signature1);
+    BOOST_REQUIRE(sign_schnorr(signature, schnorr_secret2, schnorr_message2, schnorr_auxiliary2));
+    BOOST_REQUIRE_EQUAL(signature, schnorr_signature2);
+    BOOST_REQUIRE(sign_schnorr(signature, schnorr_secret3, schnorr_message3, schnorr_auxiliary3));
+    BOOST_REQUIRE_EQUAL(signature, schnorr_signature3);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_schnorr__bip340_vectors__true)
+{
+    BOOST_REQUIRE(verify_schnorr(schnorr_point0, schnorr_message0, schnorr_signature0));
+    BOOST_REQUIRE(verify_schnorr(schnorr_point1, schnorr_message1, schnorr_signature1));
+    BOOST_REQUIRE(verify_schnorr(schnorr_point2, schnorr_message2, schnorr_signature2));
+    BOOST_REQUIRE(verify_schnorr(schnorr_point3, schnorr_message3, schnorr_signature3));
+    BOOST_REQUIRE(verify_schnorr(schnorr_point4, schnorr_message4, schnorr_signature4));
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_schnorr__negative__false)
+{
+    auto invalid = schnorr_signature1;
+    invalid[42] ^= 1;
+    BOOST_REQUIRE(!verify_schnorr(schnorr_point1, schnorr_message1, invalid));
+    BOOST_REQUIRE(!verify_schnorr(schnorr_point0, schnorr_message1, schnorr_signature1));
+    BOOST_REQUIRE(!verify_schnorr(compressed1, schnorr_message0, schnorr_signature0));
+    BOOST_REQUIRE(!verify_schnorr(schnorr_point5, schnorr_message1, schnorr_signature5));
+    BOOST_REQUIRE(!verify_schnorr(schnorr_point1, schnorr_message1, schnorr_signature6));
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signatures__mixed_schnorr__first_failure_index)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature2, false));
+
+    const signature_batch batch
+    {
+        { to_chunk(schnorr_point0), schnorr_message0, schnorr_signature0, signature_kind::schnorr },
+        { to_chunk(compressed2), sighash2, signature, signature_kind::ecdsa },
+        { to_chunk(schnorr_point1), schnorr_message1, schnorr_signature1, signature_kind::schnorr },
+        { to_chunk(schnorr_point1), schnorr_message0, schnorr_signature1, signature_kind::schnorr }
+    };
+
+    BOOST_REQUIRE_EQUAL(verify_signatures(batch), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signatures__xonly_ecdsa__zero)
+{
+    // An x-only point is not inferred to be schnorr.
+    const signature_batch batch
+    {
+        { to_chunk(schnorr_point1), schnorr_message1, schnorr_signature1, signature_kind::ecdsa }
+    };
+
+    BOOST_REQUIRE_EQUAL(verify_signatures(batch), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__tweak_xonly__tap_tweak__expected)
+{
+    bool odd{};
+    ec_xonly tweaked{};
+    const auto tweak = tagged_hash("TapTweak", schnorr_point1);
+    BOOST_REQUIRE(tweak_xonly(tweaked, odd, schnorr_point1, tweak));
+    BOOST_REQUIRE_EQUAL(tweaked, tweaked_point1);
+    BOOST_REQUIRE(odd);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_tweak__parity__expected)
+{
+    const auto tweak = tagged_hash("TapTweak", schnorr_point1);
+    BOOST_REQUIRE(verify_tweak(tweaked_point1, true, schnorr_point1, tweak));
+    BOOST_REQUIRE(!verify_tweak(tweaked_point1, false, schnorr_point1, tweak));
+    BOOST_REQUIRE(!verify_tweak(tweaked_point1, true, schnorr_point0, tweak));
+}
+
 // addition
 
 BOOST_AUTO_TEST_CASE(elliptic_curve__ec_add__positive__expected)
@@ -177,6 +378,39 @@ BOOST_AUTO_TEST_CASE(elliptic_curve__ec_add__negative__expected)
     BOOST_REQUIRE(!ec_add(public1, secret_two));
 }
 
+BOOST_AUTO_TEST_CASE(elliptic_curve__ec_add__list__expected)
+{
+    const ec_secret secret{ { 1, 2, 3 } };
+    ec_compressed point;
+    BOOST_REQUIRE(secret_to_public(point, secret));
+
+    const secret_list scalars{ { { 3, 2, 1 } }, { { 4, 5, 6 } } };
+    compressed_list sums{};
+    BOOST_REQUIRE(ec_add(sums, point, scalars));
+    BOOST_REQUIRE_EQUAL(sums.size(), scalars.size());
+
+    for (size_t index = 0; index < scalars.size(); ++index)
+    {
+        auto expected = point;
+        BOOST_REQUIRE(ec_add(expected, scalars[index]));
+        BOOST_REQUIRE_EQUAL(sums[index], expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__ec_add__list_negative__empty)
+{
+    // = n - 1
+    const auto secret = base16_array("fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364140");
+    ec_secret scalar{ { 0 } };
+    scalar[31] = 1;
+    ec_compressed point;
+    BOOST_REQUIRE(secret_to_public(point, secret));
+
+    compressed_list sums{};
+    BOOST_REQUIRE(!ec_add(sums, point, { scalar }));
+    BOOST_REQUIRE(sums.empty());
+}
+
 BOOST_AUTO_TEST_CASE(elliptic_curve__ec_sum__expected)
 {
     const compressed_list points
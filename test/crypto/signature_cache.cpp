@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(signature_cache_tests)
+
+const ec_compressed point = base16_array("03bc88a1bd6ebac38e9a9ed58eda735352ad10650e235499b7318315cc26c9b55b");
+const hash_digest sighash = base16_hash("ed8f9b40c2d349c8a7e58cebe79faa25c21b6bb85b874901f72a1b3f1ad0a67f");
+const ec_signature signature = base16_array("4832febef8b31c7c922a15cb4063a43ab69b099bba765e24facef50dfbb4d057928ed5c6b6886562c2fe6972fd7c7f462e557129067542cce6b37d72e5ea5037");
+
+BOOST_AUTO_TEST_CASE(signature_cache__capacity__zero__zero)
+{
+    const signature_cache instance{ 0 };
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__capacity__not_multiple__rounded_down)
+{
+    const signature_cache instance{ 1000 };
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 768u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__contains__zero_capacity_inserted__false)
+{
+    signature_cache instance{ 0 };
+    instance.insert(point, sighash, signature, signature_kind::ecdsa);
+    BOOST_REQUIRE(!instance.contains(point, sighash, signature, signature_kind::ecdsa));
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__contains__empty__false)
+{
+    const signature_cache instance{ 1024 };
+    BOOST_REQUIRE(!instance.contains(point, sighash, signature, signature_kind::ecdsa));
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__contains__inserted__true)
+{
+    signature_cache instance{ 1024 };
+    instance.insert(point, sighash, signature, signature_kind::ecdsa);
+    BOOST_REQUIRE(instance.contains(point, sighash, signature, signature_kind::ecdsa));
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__contains__distinct_elements__false)
+{
+    signature_cache instance{ 1024 };
+    instance.insert(point, sighash, signature, signature_kind::ecdsa);
+
+    auto other_signature = signature;
+    other_signature.front() ^= 0xff;
+    BOOST_REQUIRE(!instance.contains(point, sighash, other_signature, signature_kind::ecdsa));
+    BOOST_REQUIRE(!instance.contains(point, null_hash, signature, signature_kind::ecdsa));
+    BOOST_REQUIRE(!instance.contains(ec_compressed_generator, sighash, signature, signature_kind::ecdsa));
+    BOOST_REQUIRE(!instance.contains(point, sighash, signature, signature_kind::schnorr));
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__insert__over_capacity__bounded)
+{
+    // Minimum non-zero capacity is one bucket per shard.
+    signature_cache instance{ 256 };
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 256u);
+
+    auto hash = sighash;
+    for (auto index = 0u; index < 4096u; ++index)
+    {
+        hash.front() = narrow_cast<uint8_t>(index);
+        hash.back() = narrow_cast<uint8_t>(index >> 8);
+        instance.insert(point, hash, signature, signature_kind::ecdsa);
+    }
+
+    size_t found{};
+    for (auto index = 0u; index < 4096u; ++index)
+    {
+        hash.front() = narrow_cast<uint8_t>(index);
+        hash.back() = narrow_cast<uint8_t>(index >> 8);
+        found += instance.contains(point, hash, signature, signature_kind::ecdsa) ? 1 : 0;
+    }
+
+    BOOST_REQUIRE(!is_zero(found));
+    BOOST_REQUIRE_LE(found, instance.capacity());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -157,6 +157,24 @@ BOOST_AUTO_TEST_CASE(script_error_t__code__dirty_witness__true_exected_message)
     BOOST_REQUIRE_EQUAL(ec.message(), "dirty witness");
 }
 
+BOOST_AUTO_TEST_CASE(script_error_t__code__invalid_taproot_signature__true_exected_message)
+{
+    constexpr auto value = error::invalid_taproot_signature;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "invalid taproot signature");
+}
+
+BOOST_AUTO_TEST_CASE(script_error_t__code__unsupported_taproot_script__true_exected_message)
+{
+    constexpr auto value = error::unsupported_taproot_script;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "unsupported taproot script path");
+}
+
 BOOST_AUTO_TEST_CASE(script_error_t__code__stack_false__true_exected_message)
 {
     constexpr auto value = error::stack_false;
@@ -317,6 +317,24 @@ BOOST_AUTO_TEST_CASE(functions__bitcoin__null_one__expected)
     BOOST_CHECK_EQUAL(bitcoin_chunk(to_chunk(null_hash)), to_chunk(expected));
 }
 
+// tagged_hash
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(functions__tagged_hash__empty__expected)
+{
+    constexpr auto expected = base16_array("dabc11914abcd8072900042a2681e52f8dba99ce82e224f97b5fdb7cd4b9c803");
+    const auto tag = sha256_hash(std::string{ "TapSighash" });
+    BOOST_CHECK_EQUAL(tagged_hash("TapSighash", {}), expected);
+    BOOST_CHECK_EQUAL(sha256_hash(splice(tag, tag)), expected);
+}
+
+BOOST_AUTO_TEST_CASE(functions__tagged_hash__tap_leaf_true__expected)
+{
+    // Leaf version 0xc0 and size-prefixed script (op_true).
+    constexpr auto expected = base16_array("a85b2107f791b26a84e7586c28cec7cb61202ed3d01944d832500f363782d675");
+    BOOST_CHECK_EQUAL(tagged_hash("TapLeaf", base16_chunk("c00151")), expected);
+}
+
 // merkle_root
 // ----------------------------------------------------------------------------
 
@@ -382,6 +400,15 @@ BOOST_AUTO_TEST_CASE(functions__scrypt__empty__expected)
     BOOST_REQUIRE_EQUAL(scrypt_hash(""), expected);
 }
 
+BOOST_AUTO_TEST_CASE(functions__scrypt_hashes__empties__expected)
+{
+    const auto expected = scrypt<1024, 1, 1, true>::hash<hash_size>("", "");
+    const auto hashes = scrypt_hashes(std::vector<data_slice>(2));
+    BOOST_REQUIRE_EQUAL(hashes.size(), 2u);
+    BOOST_REQUIRE_EQUAL(hashes.front(), expected);
+    BOOST_REQUIRE_EQUAL(hashes.back(), expected);
+}
+
 // non-cryptographic hash functions
 // ----------------------------------------------------------------------------
 
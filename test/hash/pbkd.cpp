@@ -72,6 +72,69 @@ BOOST_AUTO_TEST_CASE(pbkd__sha512__test_vectors__expected)
     }
 }
 
+BOOST_AUTO_TEST_CASE(pbkd__keys__sha512_test_vectors__expected)
+{
+    std::vector<data_slice> passwords{};
+    std::vector<data_slice> salts{};
+
+    for (const auto& test: pbkd_sha512_tests)
+    {
+        passwords.emplace_back(test.passphrase);
+        salts.emplace_back(test.salt);
+    }
+
+    // Counts differ across vectors, so each pair is derived separately.
+    for (size_t pair = 0; pair < pbkd_sha512_tests.size(); ++pair)
+    {
+        const auto& test = pbkd_sha512_tests[pair];
+        const auto keys = pbkd<sha512>::keys<long_hash_size>(
+            { passwords[pair] }, { salts[pair] }, test.count);
+        BOOST_REQUIRE_EQUAL(keys.size(), one);
+        BOOST_REQUIRE_EQUAL(keys.front(), test.expected);
+    }
+}
+
 #endif // HAVE_SLOW_TESTS
 
+BOOST_AUTO_TEST_CASE(pbkd__keys__mismatched_pairs__empty)
+{
+    const std::string text{ "abc" };
+    const std::vector<data_slice> two_slices{ text, text };
+    const std::vector<data_slice> one_slice{ text };
+    BOOST_REQUIRE(pbkd<sha512>::keys<long_hash_size>(two_slices, one_slice, 2).empty());
+    BOOST_REQUIRE(pbkd<sha512>::keys<long_hash_size>({}, {}, 2).empty());
+}
+
+BOOST_AUTO_TEST_CASE(pbkd__keys__sha256_sha512_rmd160__same_as_key)
+{
+    const std::vector<std::string> passwords
+    {
+        "", "a", "password", "passwordPASSWORDpassword", std::string(200, 'x'),
+        "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", "10", "11"
+    };
+
+    std::vector<data_slice> passes{};
+    std::vector<data_slice> salts{};
+    for (const auto& password: passwords)
+    {
+        passes.emplace_back(password);
+        salts.emplace_back(password + "salt");
+    }
+
+    // Multiple blocks with partial last block, across all lane widths.
+    const auto keys256 = pbkd<sha256>::keys<100>(passes, salts, 3);
+    const auto keys512 = pbkd<sha512>::keys<130>(passes, salts, 3);
+    const auto keys160 = pbkd<rmd160>::keys<short_hash_size>(passes, salts, 3);
+    BOOST_REQUIRE_EQUAL(keys256.size(), passes.size());
+    BOOST_REQUIRE_EQUAL(keys512.size(), passes.size());
+    BOOST_REQUIRE_EQUAL(keys160.size(), passes.size());
+
+    for (size_t pair = 0; pair < passes.size(); ++pair)
+    {
+        BOOST_REQUIRE_EQUAL(keys256[pair], (pbkd<sha256>::key<100>(passes[pair], salts[pair], 3)));
+        BOOST_REQUIRE_EQUAL(keys512[pair], (pbkd<sha512>::key<130>(passes[pair], salts[pair], 3)));
+        BOOST_REQUIRE_EQUAL(keys160[pair], (pbkd<rmd160>::key<short_hash_size>(passes[pair], salts[pair], 3)));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -85,6 +85,56 @@ BOOST_AUTO_TEST_CASE(scrypt__rfc7914__hash_1__expected)
     BOOST_REQUIRE_EQUAL(hash, expected);
 }
 
+BOOST_AUTO_TEST_CASE(scrypt__hashes__mismatched_pairs__empty)
+{
+    using test = scrypt<16, 1, 1, true>;
+    const std::string text{ "abc" };
+    const std::vector<data_slice> passwords(2, text);
+    const std::vector<data_slice> salts(1, text);
+    BOOST_REQUIRE(test::hashes<hash_size>(passwords, salts).empty());
+}
+
+BOOST_AUTO_TEST_CASE(scrypt__hashes__concurrent__expected)
+{
+    // More pairs than the widest vector lanes, with a remainder.
+    using test = scrypt<16, 2, 3, true>;
+    std::vector<std::string> passwords{};
+    std::vector<std::string> salts{};
+    for (size_t pair = 0; pair < 19; ++pair)
+    {
+        passwords.emplace_back(pair, 'p');
+        salts.push_back("salt" + std::to_string(pair));
+    }
+
+    const std::vector<data_slice> password_slices(passwords.begin(),
+        passwords.end());
+    const std::vector<data_slice> salt_slices(salts.begin(), salts.end());
+    const auto hashes = test::hashes<hash_size>(password_slices, salt_slices);
+    BOOST_REQUIRE_EQUAL(hashes.size(), passwords.size());
+
+    for (size_t pair = 0; pair < hashes.size(); ++pair)
+    {
+        const auto expected = scrypt<16, 2, 3, false>::hash<hash_size>(
+            passwords[pair], salts[pair]);
+        BOOST_REQUIRE_EQUAL(hashes[pair], expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(scrypt__hashes__rfc7914_hash_1__expected)
+{
+    using test = scrypt<16, 1, 1, true>;
+    constexpr auto expected = base16_array("77d6576238657b203b19ca42c18a0497f16b4844e3074ae8dfdffa3fede21442fcd0069ded0948f8326a753a0fc81f17e8d3e0fb2e0d3628cf35e20c38d18906");
+    constexpr auto size = size_of<decltype(expected)>();
+    const std::vector<data_slice> empties(17, data_slice{});
+    const auto hashes = test::hashes<size>(empties, empties);
+    BOOST_REQUIRE_EQUAL(hashes.size(), empties.size());
+
+    for (const auto& hash: hashes)
+    {
+        BOOST_REQUIRE_EQUAL(hash, expected);
+    }
+}
+
 // 6+ seconds of test here.
 #if defined(HAVE_SLOW_TESTS)
 
@@ -124,6 +174,21 @@ BOOST_AUTO_TEST_CASE(scrypt__scrypt_hash__test_vectors__expected)
     }
 }
 
+BOOST_AUTO_TEST_CASE(scrypt__scrypt_hashes__test_vectors__expected)
+{
+    std::vector<data_slice> set{};
+    for (const auto& test: scrypt_hash_tests)
+        set.emplace_back(test.data);
+
+    const auto hashes = scrypt_hashes(set);
+    BOOST_REQUIRE_EQUAL(hashes.size(), scrypt_hash_tests.size());
+
+    for (size_t index = 0; index < hashes.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(hashes[index], scrypt_hash_tests[index].expected);
+    }
+}
+
 #endif // HAVE_SLOW_TESTS
 
 BOOST_AUTO_TEST_SUITE_END()
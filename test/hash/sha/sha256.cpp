@@ -264,4 +264,51 @@ BOOST_AUTO_TEST_CASE(sha256__merkle_root__four__expected)
     BOOST_CHECK_EQUAL(sha256::merkle_root({ { 0 }, { 1 }, { 2 }, { 3 } }), expected);
 }
 
+// sha256::double_hashes
+BOOST_AUTO_TEST_CASE(sha256__double_hashes__empty__empty)
+{
+    BOOST_REQUIRE(sha256::double_hashes({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(sha256__double_hashes__all_lengths__expected)
+{
+    // Lengths span all padding boundaries and produce buckets of each size.
+    data_chunk data(300);
+    std::iota(data.begin(), data.end(), 0_u8);
+    sha256::messages_t messages{};
+    for (size_t size = 0; size < data.size(); ++size)
+        messages.emplace_back(data.data(), std::next(data.data(), size));
+
+    const auto digests = sha256::double_hashes(messages);
+    BOOST_REQUIRE_EQUAL(digests.size(), messages.size());
+
+    for (size_t index = 0; index < messages.size(); ++index)
+    {
+        const auto& message = messages[index];
+        const auto expected = accumulator<sha256>::double_hash(message.size(), message.data());
+        BOOST_CHECK_EQUAL(digests[index], expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha256__double_hashes__not_vectorized__expected)
+{
+    using sha_256 = sha::algorithm<sha::h256<>, true, false, true>;
+    static_assert(!sha_256::vector);
+
+    const data_chunk data(200, 0x42);
+    sha_256::messages_t messages{};
+    for (size_t size = 0; size < data.size(); size += 7)
+        messages.emplace_back(data.data(), std::next(data.data(), size));
+
+    const auto digests = sha_256::double_hashes(messages);
+    BOOST_REQUIRE_EQUAL(digests.size(), messages.size());
+
+    for (size_t index = 0; index < messages.size(); ++index)
+    {
+        const auto& message = messages[index];
+        const auto expected = accumulator<sha256>::double_hash(message.size(), message.data());
+        BOOST_CHECK_EQUAL(digests[index], expected);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -43,6 +43,16 @@ BOOST_AUTO_TEST_SUITE(intrinsics_haves_tests)
 #else
     static_assert(!with_shani);
 #endif
+#if defined(HAVE_AESNI)
+    static_assert(with_aesni);
+#else
+    static_assert(!with_aesni);
+#endif
+#if defined(HAVE_VAES)
+    static_assert(with_vaes);
+#else
+    static_assert(!with_vaes);
+#endif
 #if defined(HAVE_NEON)
     static_assert(with_neon);
 #else
@@ -102,6 +112,24 @@ BOOST_AUTO_TEST_CASE(intrinsics_haves__try_shani__always__match)
         get_right(ebx, cpu7_0::shani_ebx_bit), try_shani());
 }
 
+BOOST_AUTO_TEST_CASE(intrinsics_haves__try_aesni__always__match)
+{
+    uint32_t eax{}, ebx{}, ecx{}, edx{};
+    BOOST_CHECK_EQUAL(
+        get_cpu(eax, ebx, ecx, edx, cpu1_0::leaf, cpu1_0::subleaf) &&
+        get_right(ecx, cpu1_0::sse41_ecx_bit) &&
+        get_right(ecx, cpu1_0::aes_ecx_bit), try_aesni());
+}
+
+BOOST_AUTO_TEST_CASE(intrinsics_haves__try_vaes__always__match)
+{
+    uint32_t eax{}, ebx{}, ecx{}, edx{};
+    BOOST_CHECK_EQUAL(
+        try_aesni() && try_avx512() &&
+        get_cpu(eax, ebx, ecx, edx, cpu7_0::leaf, cpu7_0::subleaf) &&
+        get_right(ecx, cpu7_0::vaes_ecx_bit), try_vaes());
+}
+
 // Unknown vector.
 ////BOOST_AUTO_TEST_CASE(intrinsics_haves__try_neon__always__match)
 ////{
@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+constexpr uint256 max256 = ~uint256{};
+
+// width
+static_assert(uint256{}.width() == 0u);
+static_assert(uint256{ 1 }.width() == 1u);
+static_assert(max256.width() == 256u);
+static_assert((uint256{ 1 } << 200).width() == 201u);
+
+// operator bool
+static_assert(!uint256{});
+static_assert(static_cast<bool>(uint256{ 42 }));
+
+// increment, addition and subtraction wrap
+static_assert(++uint256{ max256 } == uint256{});
+static_assert(max256 + uint256{ 2 } == uint256{ 1 });
+static_assert(uint256{} - uint256{ 1 } == max256);
+static_assert(uint256{ { max_uint64, 0, 0, 0 } } + uint256{ 1 } == uint256{ { 0, 1, 0, 0 } });
+
+// shifts
+static_assert((uint256{ 1 } << 64) == uint256{ { 0, 1, 0, 0 } });
+static_assert((uint256{ 1 } << 256) == uint256{});
+static_assert((max256 >> 255) == uint256{ 1 });
+static_assert((max256 >> 256) == uint256{});
+static_assert((uint256{ { 0, 1, 0, 0 } } >> 1) == uint256{ { 0x8000000000000000, 0, 0, 0 } });
+
+// multiplication wraps
+static_assert(uint256{ 3 } * 5u == uint256{ 15 });
+static_assert((max256 * 2u) == (max256 - uint256{ 1 }));
+
+// division
+static_assert(uint256{ 15 } / 4u == uint256{ 3 });
+static_assert(uint256{ 15 } / 0u == uint256{});
+static_assert(uint256{ 15 } / uint256{ 4 } == uint256{ 3 });
+static_assert(uint256{ 15 } / uint256{} == uint256{});
+static_assert(max256 / max256 == uint256{ 1 });
+static_assert(max256 / (uint256{ 1 } << 255) == uint256{ 1 });
+
+// comparison
+static_assert(uint256{ { 0, 0, 0, 1 } } > uint256{ { max_uint64, max_uint64, max_uint64, 0 } });
+static_assert(uint256{ 1 } < uint256{ 2 });
+static_assert(uint256{ 2 } <= uint256{ 2 });
+static_assert(uint256{ 2 } >= uint256{ 2 });
+static_assert(uint256{ 2 } != uint256{ 3 });
+
+// little endian
+static_assert(uint256::from_little_endian(uint256{ 0x0102 }.to_little_endian()) == uint256{ 0x0102 });
+static_assert(uint256{ 0x0102 }.to_little_endian()[0] == 0x02);
+static_assert(uint256{ 0x0102 }.to_little_endian()[1] == 0x01);
+
+BOOST_AUTO_TEST_SUITE(uint256_tests)
+
+static const auto value1 = to_uintx(base16_hash("00000000ffff0000000000000000000000000000000000000000000000000000"));
+static const auto value2 = to_uintx(base16_hash("0123456789abcdeffedcba98765432100123456789abcdeffedcba9876543210"));
+static const auto value3 = to_uintx(base16_hash("000000000000000000000000000000000000000000000000000000000001e240"));
+
+BOOST_AUTO_TEST_CASE(uint256__to_uintx__round_trip__expected)
+{
+    BOOST_REQUIRE_EQUAL(uint256{ value1 }.to_uintx(), value1);
+    BOOST_REQUIRE_EQUAL(uint256{ value2 }.to_uintx(), value2);
+    BOOST_REQUIRE_EQUAL(uint256{ value3 }.to_uintx(), value3);
+    BOOST_REQUIRE_EQUAL(uint256{}.to_uintx(), uint256_t{});
+}
+
+BOOST_AUTO_TEST_CASE(uint256__from_little_endian__hash__to_uintx)
+{
+    const auto hash = base16_hash("0123456789abcdeffedcba98765432100123456789abcdeffedcba9876543210");
+    BOOST_REQUIRE_EQUAL(uint256::from_little_endian(hash).to_uintx(), to_uintx(hash));
+    BOOST_REQUIRE_EQUAL(uint256{ to_uintx(hash) }.to_little_endian(), hash);
+}
+
+BOOST_AUTO_TEST_CASE(uint256__operators__uintx__expected)
+{
+    const uint256 fixed1{ value1 };
+    const uint256 fixed2{ value2 };
+    const uint256 fixed3{ value3 };
+
+    BOOST_REQUIRE_EQUAL((fixed1 + fixed2).to_uintx(), uint256_t(value1 + value2));
+    BOOST_REQUIRE_EQUAL((fixed1 - fixed2).to_uintx(), uint256_t(value1 - value2));
+    BOOST_REQUIRE_EQUAL((~fixed2).to_uintx(), uint256_t(~value2));
+    BOOST_REQUIRE_EQUAL((fixed2 << 77).to_uintx(), uint256_t(value2 << 77));
+    BOOST_REQUIRE_EQUAL((fixed2 >> 131).to_uintx(), uint256_t(value2 >> 131));
+    BOOST_REQUIRE_EQUAL((fixed2 * 1209600u).to_uintx(), uint256_t(value2 * 1209600u));
+    BOOST_REQUIRE_EQUAL((fixed2 / 1209600u).to_uintx(), uint256_t(value2 / 1209600u));
+    BOOST_REQUIRE_EQUAL((fixed2 / fixed1).to_uintx(), uint256_t(value2 / value1));
+    BOOST_REQUIRE_EQUAL((fixed2 / fixed3).to_uintx(), uint256_t(value2 / value3));
+    BOOST_REQUIRE_EQUAL(fixed2.width(), add1(floored_log2(value2)));
+    BOOST_REQUIRE_EQUAL(fixed1 < fixed2, value1 < value2);
+}
+
+BOOST_AUTO_TEST_CASE(uint256__division__proof__uintx)
+{
+    const uint256 target{ value1 };
+    const auto expected = ++(~value1 / (value1 + one));
+    BOOST_REQUIRE_EQUAL((++(~target / (target + one))).to_uintx(), expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -108,4 +108,54 @@ BOOST_AUTO_TEST_CASE(base58__decode_base58__array__expected)
     BOOST_REQUIRE_EQUAL(converted, expected);
 }
 
+BOOST_AUTO_TEST_CASE(base58__is_base58__high_bit__false)
+{
+    BOOST_REQUIRE(!is_base58(static_cast<char>(0x80)));
+    BOOST_REQUIRE(!is_base58(static_cast<char>(0xff)));
+}
+
+BOOST_AUTO_TEST_CASE(base58__encode_base58__buffer__expected)
+{
+    const auto data = base16_chunk("00eb15231dfceb60925886b67d065299925915aeb172c06647");
+    std::array<char, base58_size(25)> buffer{};
+    const auto size = encode_base58(buffer.data(), buffer.size(), data);
+    BOOST_REQUIRE_EQUAL(std::string(buffer.data(), size), "1NS17iag9jJgTHD1VXjvLCEnZuQ3rJDE9L");
+}
+
+BOOST_AUTO_TEST_CASE(base58__encode_base58__insufficient_buffer__zero)
+{
+    const auto data = base16_chunk("00eb15231dfceb60925886b67d065299925915aeb172c06647");
+    std::array<char, 33> buffer{};
+    BOOST_REQUIRE_EQUAL(encode_base58(buffer.data(), buffer.size(), data), zero);
+}
+
+BOOST_AUTO_TEST_CASE(base58__encode_base58__large__round_trip)
+{
+    data_chunk data(500, 0x00);
+    for (size_t index = 0; index < data.size(); ++index)
+        data[index] = static_cast<uint8_t>(index * 7u);
+
+    data_chunk decoded{};
+    BOOST_REQUIRE(decode_base58(decoded, encode_base58(data)));
+    BOOST_REQUIRE_EQUAL(decoded, data);
+}
+
+BOOST_AUTO_TEST_CASE(base58__decode_base58__array_wrong_size__false)
+{
+    data_array<24> short_array{};
+    data_array<26> long_array{};
+    BOOST_REQUIRE(!decode_base58(short_array, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFViT"));
+    BOOST_REQUIRE(!decode_base58(long_array, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFViT"));
+    BOOST_REQUIRE_EQUAL(short_array, data_array<24>{});
+}
+
+BOOST_AUTO_TEST_CASE(base58__decode_base58__invalid_character__false)
+{
+    data_chunk out{ 42 };
+    data_array<25> array{};
+    BOOST_REQUIRE(!decode_base58(out, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFVi0"));
+    BOOST_REQUIRE(out.empty());
+    BOOST_REQUIRE(!decode_base58(array, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFVi0"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
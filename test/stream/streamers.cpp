@@ -44,6 +44,14 @@ BOOST_AUTO_TEST_CASE(read__bytes__fast__expected)
     BOOST_REQUIRE_EQUAL(reader.read_byte(), '*');
 }
 
+BOOST_AUTO_TEST_CASE(read__bytes__fast__final)
+{
+    static_assert(std::is_final_v<read::bytes::fast>);
+    static_assert(std::is_final_v<stream::in::fast>);
+    static_assert(std::is_base_of_v<bytereader, read::bytes::fast>);
+    BOOST_REQUIRE(true);
+}
+
 BOOST_AUTO_TEST_CASE(read__bytes__copy__expected)
 {
     const data_chunk source{ '*' };
@@ -93,4 +93,42 @@ BOOST_AUTO_TEST_CASE(hd_public__derive_public__long_seed__expected)
     BOOST_REQUIRE_EQUAL(m0xH1yH2_pub.encoded(), "xpub6FnCn6nSzZAw5Tw7cgR9bi15UV96gLZhjDstkXXxvCLsUXBGXPdSnLFbdpq8p9HmGsApME5hQTZ3emM2rnY5agb9rXpVGyy3bdW6EEgAtqt");
 }
 
+BOOST_AUTO_TEST_CASE(hd_public__derive_public_range__hardened__empty)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, SHORT_SEED));
+
+    const hd_public m_pub = hd_private(seed, hd_private::mainnet);
+    BOOST_REQUIRE(m_pub.derive_public_range(hd_first_hardened_key, 1).empty());
+    BOOST_REQUIRE(m_pub.derive_public_range(sub1(hd_first_hardened_key), 2).empty());
+    BOOST_REQUIRE(!m_pub.derive_public_range(sub1(hd_first_hardened_key), 1).empty());
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_public_range__zero_count__empty)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, SHORT_SEED));
+
+    const hd_public m_pub = hd_private(seed, hd_private::mainnet);
+    BOOST_REQUIRE(m_pub.derive_public_range(0, 0).empty());
+    BOOST_REQUIRE(hd_public{}.derive_public_range(0, 1).empty());
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_public_range__long_seed__derive_public)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, LONG_SEED));
+
+    const hd_private m(seed, hd_private::mainnet);
+    const auto m0 = m.derive_public(0);
+    const auto points = m0.derive_public_range(42, 20);
+    BOOST_REQUIRE_EQUAL(points.size(), 20u);
+
+    for (uint32_t index = 0; index < points.size(); ++index)
+        BOOST_REQUIRE_EQUAL(points[index], m0.derive_public(42 + index).point());
+
+    // Inherited by hd_private, derived from the private key's point.
+    BOOST_REQUIRE_EQUAL(m.derive_public_range(0, 1).front(), m0.point());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
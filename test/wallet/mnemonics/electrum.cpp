@@ -224,6 +224,86 @@ BOOST_AUTO_TEST_CASE(electrum__to_seed__todo1__todo)
     BOOST_REQUIRE(TODO_TESTS);
 }
 
+// search
+
+BOOST_AUTO_TEST_CASE(electrum__search__invalid__invalid)
+{
+    const auto any = [](const hd_private&) NOEXCEPT { return true; };
+    const auto words = split(vectors[electrum_vector::english].mnemonic);
+    BOOST_REQUIRE(!electrum::search({ "wild" }, prefix::witness, any));
+    BOOST_REQUIRE(!electrum::search(words, prefix::witness, {}));
+    BOOST_REQUIRE(!electrum::search(words, prefix::old, any));
+    BOOST_REQUIRE(!electrum::search(words, prefix::bip39, any));
+    BOOST_REQUIRE(!electrum::search(words, prefix::none, any));
+    BOOST_REQUIRE(!electrum::search(words, prefix::witness, any, {}, 1, "", language::none));
+}
+
+BOOST_AUTO_TEST_CASE(electrum__search__one_unknown__expected)
+{
+    const auto vector = vectors[electrum_vector::english];
+    const auto key = vector.to_hd();
+    const auto match = [&](const hd_private& candidate) NOEXCEPT
+    {
+        return candidate == key;
+    };
+
+    auto words = split(vector.mnemonic);
+    words.at(3).clear();
+
+    const auto instance = electrum::search(words, vector.prefix, match, {},
+        2, vector.passphrase, vector.lingo);
+
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE(instance.prefix() == vector.prefix);
+    BOOST_REQUIRE(instance.lingo() == vector.lingo);
+    BOOST_REQUIRE_EQUAL(instance.words(), split(vector.mnemonic));
+    BOOST_REQUIRE_EQUAL(instance.to_key(vector.passphrase), key);
+}
+
+BOOST_AUTO_TEST_CASE(electrum__search__passphrase__expected)
+{
+    const auto vector = vectors[electrum_vector::english_with_passphrase];
+    const auto key = vector.to_hd();
+    const auto match = [&](const hd_private& candidate) NOEXCEPT
+    {
+        return candidate == key;
+    };
+
+    auto words = split(vector.mnemonic);
+    words.back().clear();
+
+    const auto instance = electrum::search(words, vector.prefix, match, {},
+        1, vector.passphrase, vector.lingo);
+
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE_EQUAL(instance.words(), split(vector.mnemonic));
+}
+
+BOOST_AUTO_TEST_CASE(electrum__search__wrong_prefix__invalid)
+{
+    const auto vector = vectors[electrum_vector::english];
+    const auto key = vector.to_hd();
+    const auto match = [&](const hd_private& candidate) NOEXCEPT
+    {
+        return candidate == key;
+    };
+
+    uint64_t tried{};
+    const auto report = [&](uint64_t done, uint64_t) NOEXCEPT
+    {
+        tried = done;
+        return true;
+    };
+
+    auto words = split(vector.mnemonic);
+    words.back().clear();
+
+    // The target phrase is filtered out by seed version (not standard).
+    BOOST_REQUIRE(!electrum::search(words, prefix::standard, match, report,
+        1, vector.passphrase, vector.lingo));
+    BOOST_REQUIRE_EQUAL(tried, electrum::dictionary::size());
+}
+
 #endif // PUBLIC_STATIC
 
 #ifdef PROTECTED_STATIC
@@ -124,6 +124,142 @@ BOOST_AUTO_TEST_CASE(mnemonic__is_valid_word_count__valid__true)
     BOOST_CHECK(mnemonic::is_valid_word_count(24));
 }
 
+// search
+
+BOOST_AUTO_TEST_CASE(mnemonic__search__invalid__invalid)
+{
+    const auto any = [](const hd_private&) NOEXCEPT { return true; };
+    auto words = vectors_en[0].words();
+    BOOST_REQUIRE(!mnemonic::search({ "abandon" }, any));
+    BOOST_REQUIRE(!mnemonic::search(words, {}));
+    BOOST_REQUIRE(!mnemonic::search(words, any, {}, 1, "", language::none));
+
+    words.front() = "bogus";
+    BOOST_REQUIRE(!mnemonic::search(words, any));
+
+    // Six unknowns exceeds recovery::maximum_unknowns.
+    const string_list unknowns{ "", "", "", "", "", "", "abandon", "abandon",
+        "abandon", "abandon", "abandon", "about" };
+    BOOST_REQUIRE(!mnemonic::search(unknowns, any));
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic__search__no_unknowns__expected)
+{
+    const auto& vector = vectors_en[0];
+    const auto key = vector.hd_key();
+    const auto match = [&](const hd_private& candidate) NOEXCEPT
+    {
+        return candidate == key;
+    };
+
+    const auto instance = mnemonic::search(vector.words(), match, {}, 1,
+        vector.passphrase);
+
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE(instance.lingo() == language::en);
+    BOOST_REQUIRE_EQUAL(instance.entropy(), vector.entropy());
+    BOOST_REQUIRE_EQUAL(instance.words(), vector.words());
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic__search__one_unknown_threads__expected)
+{
+    const auto& vector = vectors_en[1];
+    const auto key = vector.hd_key();
+    const auto match = [&](const hd_private& candidate) NOEXCEPT
+    {
+        return candidate == key;
+    };
+
+    auto words = vector.words();
+    words.at(5).clear();
+
+    const auto instance = mnemonic::search(words, match, {}, 4,
+        vector.passphrase);
+
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE_EQUAL(instance.entropy(), vector.entropy());
+    BOOST_REQUIRE_EQUAL(instance.words(), vector.words());
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic__search__two_unknowns_fingerprint__expected)
+{
+    const auto& vector = vectors_en[0];
+    const auto master = vector.hd_key();
+    const auto fingerprint = master.derive_private(0).lineage().parent_fingerprint;
+
+    auto words = vector.words();
+    words.front().clear();
+    words.back().clear();
+
+    // Candidates are enumerated in order, and "abandon" is the first word.
+    const auto match = recovery::match_fingerprint(fingerprint);
+    const auto instance = mnemonic::search(words, match, {}, 2,
+        vector.passphrase);
+
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE_EQUAL(instance.words(), vector.words());
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic__search__address__expected)
+{
+    const auto& vector = vectors_en[0];
+    const auto child = vector.hd_key().derive_private(hd_first_hardened_key);
+    const payment_address address{ ec_public{ child.to_public().point() } };
+
+    auto words = vector.words();
+    words.back().clear();
+
+    const auto match = recovery::match_address(address,
+        { hd_first_hardened_key });
+    const auto instance = mnemonic::search(words, match, {}, 1,
+        vector.passphrase);
+
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE_EQUAL(instance.words(), vector.words());
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic__search__not_found__progress_complete)
+{
+    const auto none = [](const hd_private&) NOEXCEPT { return false; };
+    uint64_t reports{};
+    uint64_t tried{};
+    uint64_t total{};
+    const auto report = [&](uint64_t done, uint64_t count) NOEXCEPT
+    {
+        ++reports;
+        tried = done;
+        total = count;
+        return true;
+    };
+
+    auto words = vectors_en[0].words();
+    words.back().clear();
+
+    BOOST_REQUIRE(!mnemonic::search(words, none, report));
+    BOOST_REQUIRE_EQUAL(reports, 1u);
+    BOOST_REQUIRE_EQUAL(tried, mnemonic::dictionary::size());
+    BOOST_REQUIRE_EQUAL(total, mnemonic::dictionary::size());
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic__search__cancelled__invalid)
+{
+    const auto none = [](const hd_private&) NOEXCEPT { return false; };
+    uint64_t reports{};
+    const auto cancel = [&](uint64_t, uint64_t) NOEXCEPT
+    {
+        ++reports;
+        return false;
+    };
+
+    // Cancelled after the first of 2048 chunks (of 2048 candidates each).
+    auto words = vectors_en[0].words();
+    words.front().clear();
+    words.back().clear();
+
+    BOOST_REQUIRE(!mnemonic::search(words, none, cancel));
+    BOOST_REQUIRE_EQUAL(reports, 1u);
+}
+
 #endif // PUBLIC_STATIC
 
 #ifdef PROTECTED_STATIC
@@ -414,6 +550,28 @@ BOOST_AUTO_TEST_CASE(mnemonic__to_seed__todo__todo)
     BOOST_CHECK(TODO_TESTS);
 }
 
+BOOST_AUTO_TEST_CASE(mnemonic__to_seeds__passphrases__same_as_to_seed)
+{
+    const mnemonic instance(words12);
+    BOOST_REQUIRE(instance);
+
+    const string_list passphrases{ "", "foo", "bar", "baz", "qux", "quux" };
+    const auto seeds = instance.to_seeds(passphrases);
+    BOOST_REQUIRE_EQUAL(seeds.size(), passphrases.size());
+
+    for (size_t index = 0; index < seeds.size(); ++index)
+        BOOST_REQUIRE_EQUAL(seeds[index], instance.to_seed(passphrases[index]));
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic__to_seeds__passphrases_invalid__nulls)
+{
+    const mnemonic instance{};
+    const auto seeds = instance.to_seeds({ "foo", "bar" });
+    BOOST_REQUIRE_EQUAL(seeds.size(), two);
+    BOOST_REQUIRE_EQUAL(seeds.front(), long_hash{});
+    BOOST_REQUIRE_EQUAL(seeds.back(), long_hash{});
+}
+
 #endif // PUBLIC_METHODS
 
 #ifdef OPERATORS
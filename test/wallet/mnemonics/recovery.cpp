@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2011-2023 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(recovery_tests)
+
+using namespace bc::system::wallet;
+
+// BIP32 test vector 1 master private key (fingerprint 3442193e).
+const hd_private master{ "xprv9s21ZrQH143K3QTDL4LXw2F7HEK3wJUD2nW2nRk4stbPy6cq3jPPqjiChkVvvNKmPGJxWUtg6LnF5kejMRNNU3TGtRBeJgk33yuGBxrMPHi" };
+
+// match_fingerprint
+
+BOOST_AUTO_TEST_CASE(recovery__match_fingerprint__master__true)
+{
+    BOOST_REQUIRE(master);
+    BOOST_REQUIRE(recovery::match_fingerprint(0x3442193e)(master));
+}
+
+BOOST_AUTO_TEST_CASE(recovery__match_fingerprint__child__false)
+{
+    const auto child = master.derive_private(hd_first_hardened_key);
+    BOOST_REQUIRE(child);
+    BOOST_REQUIRE(!recovery::match_fingerprint(0x3442193e)(child));
+}
+
+// match_address
+
+BOOST_AUTO_TEST_CASE(recovery__match_address__path__true)
+{
+    const std_vector<uint32_t> path{ hd_first_hardened_key, 1 };
+    const auto child = master.derive_private(path.front()).derive_private(path.back());
+    const payment_address address{ ec_public{ child.to_public().point() } };
+    BOOST_REQUIRE(recovery::match_address(address, path)(master));
+}
+
+BOOST_AUTO_TEST_CASE(recovery__match_address__testnet_path__true)
+{
+    const std_vector<uint32_t> path{ 42 };
+    const auto child = master.derive_private(path.front());
+    const payment_address address{ ec_public{ child.to_public().point() }, payment_address::testnet_p2kh };
+    BOOST_REQUIRE(recovery::match_address(address, path)(master));
+}
+
+BOOST_AUTO_TEST_CASE(recovery__match_address__wrong_path__false)
+{
+    const auto child = master.derive_private(hd_first_hardened_key);
+    const payment_address address{ ec_public{ child.to_public().point() } };
+    BOOST_REQUIRE(!recovery::match_address(address)(master));
+    BOOST_REQUIRE(!recovery::match_address(address, { 0 })(master));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -3594,4 +3594,114 @@ BOOST_AUTO_TEST_CASE(neutrino__match_filter_2__unrelated_address__false)
     BOOST_REQUIRE(!neutrino::match_filter(filter, addresses));
 }
 
+BOOST_AUTO_TEST_CASE(neutrino__decode_filter__truncated__false)
+{
+    const neutrino::block_filter filter
+    {
+        base16_hash("00000000fd3ceb2404ff07a785c7fdcc76619edc8ed61bd25134eaa22084366a"),
+        base16_chunk("0db414c859a07e8205876354a210a75042d0")
+    };
+
+    neutrino::decoded_filter decoded{};
+    BOOST_REQUIRE(!neutrino::decode_filter(decoded, filter));
+}
+
+BOOST_AUTO_TEST_CASE(neutrino__decode_filter__valid__expected_size)
+{
+    const neutrino::block_filter filter
+    {
+        base16_hash("00000000fd3ceb2404ff07a785c7fdcc76619edc8ed61bd25134eaa22084366a"),
+        base16_chunk("0db414c859a07e8205876354a210a75042d0463404913d61a8e068e58a3ae2aa080026")
+    };
+
+    neutrino::decoded_filter decoded{};
+    BOOST_REQUIRE(neutrino::decode_filter(decoded, filter));
+    BOOST_REQUIRE_EQUAL(decoded.set.size(), 13u);
+    BOOST_REQUIRE(std::is_sorted(decoded.set.begin(), decoded.set.end()));
+}
+
+BOOST_AUTO_TEST_CASE(neutrino__match_filter_decoded_1__input_prevout__true)
+{
+    const neutrino::block_filter filter
+    {
+        base16_hash("00000000fd3ceb2404ff07a785c7fdcc76619edc8ed61bd25134eaa22084366a"),
+        base16_chunk("0db414c859a07e8205876354a210a75042d0463404913d61a8e068e58a3ae2aa080026")
+    };
+
+    const wallet::payment_address address
+    {
+        base16_array("001fa7459a6cfc64bdc178ba7e7a21603bb2568f"),
+        wallet::payment_address::testnet_p2kh
+    };
+
+    neutrino::decoded_filter decoded{};
+    BOOST_REQUIRE(neutrino::decode_filter(decoded, filter));
+    BOOST_REQUIRE(neutrino::match_filter(decoded, address));
+}
+
+BOOST_AUTO_TEST_CASE(neutrino__match_filter_decoded_1__unrelated_address__false)
+{
+    const neutrino::block_filter filter
+    {
+        base16_hash("00000000fd3ceb2404ff07a785c7fdcc76619edc8ed61bd25134eaa22084366a"),
+        base16_chunk("0db414c859a07e8205876354a210a75042d0463404913d61a8e068e58a3ae2aa080026")
+    };
+
+    const wallet::payment_address address
+    {
+        base16_array("001fa005900cf004b00100ba700021000b00500f"),
+        wallet::payment_address::testnet_p2kh
+    };
+
+    neutrino::decoded_filter decoded{};
+    BOOST_REQUIRE(neutrino::decode_filter(decoded, filter));
+    BOOST_REQUIRE(!neutrino::match_filter(decoded, address));
+}
+
+BOOST_AUTO_TEST_CASE(neutrino__match_filter_decoded_2__input_prevout__true)
+{
+    const neutrino::block_filter filter
+    {
+        base16_hash("00000000fd3ceb2404ff07a785c7fdcc76619edc8ed61bd25134eaa22084366a"),
+        base16_chunk("0db414c859a07e8205876354a210a75042d0463404913d61a8e068e58a3ae2aa080026")
+    };
+
+    const wallet::payment_address::list addresses
+    {
+        {
+            base16_array("001fa7459a6cfc64bdc100ba700a21003b005000"),
+            wallet::payment_address::testnet_p2kh
+        },
+        {
+            base16_array("001fa7459a6cfc64bdc178ba7e7a21603bb2568f"),
+            wallet::payment_address::testnet_p2kh
+        }
+    };
+
+    neutrino::decoded_filter decoded{};
+    BOOST_REQUIRE(neutrino::decode_filter(decoded, filter));
+    BOOST_REQUIRE(neutrino::match_filter(decoded, addresses));
+}
+
+BOOST_AUTO_TEST_CASE(neutrino__match_filter_decoded_2__unrelated_address__false)
+{
+    const neutrino::block_filter filter
+    {
+        base16_hash("00000000fd3ceb2404ff07a785c7fdcc76619edc8ed61bd25134eaa22084366a"),
+        base16_chunk("0db414c859a07e8205876354a210a75042d0463404913d61a8e068e58a3ae2aa080026")
+    };
+
+    const wallet::payment_address::list addresses
+    {
+        {
+            base16_array("001fa7459a6cfc64bdc100ba700a21003b005000"),
+            wallet::payment_address::testnet_p2kh
+        }
+    };
+
+    neutrino::decoded_filter decoded{};
+    BOOST_REQUIRE(neutrino::decode_filter(decoded, filter));
+    BOOST_REQUIRE(!neutrino::match_filter(decoded, addresses));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -87,8 +87,8 @@ static ptrdiff_t abnormals(const electrum::catalog::words& words)
 
 // This differs from BIP39 in nfkd normalization.
 // This was normalized after publication, so probably not updated.
-const electrum::catalog::words electrum_es
-{
+constexpr electrum::catalog::words electrum_es = electrum::catalog::hash
+(
     false,
     {
         "ábaco",
@@ -2140,12 +2140,12 @@ const electrum::catalog::words electrum_es
         "zumo",
         "zurdo"
     }
-};
+);
 
 // This differs from BIP39 in nfkd normalization.
 // This was normalized after publication, so probably not updated.
-const electrum::catalog::words electrum_ja
-{
+constexpr electrum::catalog::words electrum_ja = electrum::catalog::hash
+(
     false,
     {
         "あいこくしん",
@@ -4197,7 +4197,7 @@ const electrum::catalog::words electrum_ja
         "わらう",
         "われる"
     }
-};
+);
 
 } // catalogs_electrum
 } // test
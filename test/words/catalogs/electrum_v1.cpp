@@ -69,6 +69,14 @@ BOOST_AUTO_TEST_CASE(catalogs_electrum_v1__all__distinct__true)
     BOOST_CHECK(distinct(electrum_v1::pt));
 }
 
+// perfect
+
+BOOST_AUTO_TEST_CASE(catalogs_electrum_v1__all__perfect__true)
+{
+    BOOST_CHECK(perfect(electrum_v1::en));
+    BOOST_CHECK(perfect(electrum_v1::pt));
+}
+
 // sorted
 
 BOOST_AUTO_TEST_CASE(catalogs_electrum_v1__sorted__unsorted__false)
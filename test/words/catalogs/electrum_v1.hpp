@@ -121,6 +121,16 @@ static hash_digest identity(const electrum_v1::catalog::words& words)
     return sha256_hash(join(to_string_list(words)));
 }
 
+static bool perfect(const electrum_v1::catalog::words& words)
+{
+    const electrum_v1::catalog dictionary(language::none, words);
+    for (size_t index = 0; index < words.word.size(); ++index)
+        if (dictionary.index(words.word[index]) != to_signed(index))
+            return false;
+
+    return true;
+}
+
 } // catalogs_electrum_v1
 } // test
 
@@ -85,6 +85,22 @@ BOOST_AUTO_TEST_CASE(catalogs_mnemonic__all__distinct__true)
     BOOST_CHECK(distinct(mnemonic::zh_Hant));
 }
 
+// perfect
+
+BOOST_AUTO_TEST_CASE(catalogs_mnemonic__all__perfect__true)
+{
+    BOOST_CHECK(perfect(mnemonic::en));
+    BOOST_CHECK(perfect(mnemonic::es));
+    BOOST_CHECK(perfect(mnemonic::it));
+    BOOST_CHECK(perfect(mnemonic::fr));
+    BOOST_CHECK(perfect(mnemonic::cs));
+    BOOST_CHECK(perfect(mnemonic::pt));
+    BOOST_CHECK(perfect(mnemonic::ja));
+    BOOST_CHECK(perfect(mnemonic::ko));
+    BOOST_CHECK(perfect(mnemonic::zh_Hans));
+    BOOST_CHECK(perfect(mnemonic::zh_Hant));
+}
+
 // sorted
 
 BOOST_AUTO_TEST_CASE(catalogs_mnemonic__sorted8__sorted__true)
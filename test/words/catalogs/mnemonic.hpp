@@ -131,6 +131,16 @@ static hash_digest identity(const mnemonic::catalog::words& words)
     return sha256_hash(join(to_string_list(words)));
 }
 
+static bool perfect(const mnemonic::catalog::words& words)
+{
+    const mnemonic::catalog dictionary(language::none, words);
+    for (size_t index = 0; index < words.word.size(); ++index)
+        if (dictionary.index(words.word[index]) != to_signed(index))
+            return false;
+
+    return true;
+}
+
 } // catalogs_mnemonic
 } // test
 
@@ -32,8 +32,8 @@ typedef dictionary<test_dictionary_size>::words test_words;
 typedef words::dictionary<test_dictionary_size> test_dictionary;
 typedef words::dictionaries<5, test_dictionary::size()> test_dictionaries;
 
-const test_words test_words_en
-{
+constexpr test_words test_words_en = dictionary<test_dictionary_size>::hash
+(
     true,
     {
         "abandon",
@@ -47,10 +47,10 @@ const test_words test_words_en
         "absurd",
         "abuse"
     }
-};
+);
 
-const test_words test_words_es
-{
+constexpr test_words test_words_es = dictionary<test_dictionary_size>::hash
+(
     false,
     {
         "ábaco",
@@ -64,10 +64,10 @@ const test_words test_words_es
         "abrir",
         "abuelo"
     }
-};
+);
 
-const test_words test_words_ja
-{
+constexpr test_words test_words_ja = dictionary<test_dictionary_size>::hash
+(
     false,
     {
         "あいこくしん",
@@ -81,10 +81,10 @@ const test_words test_words_ja
         "あこがれる",
         "あさい"
     }
-};
+);
 
-const test_words test_words_zh_Hans
-{
+constexpr test_words test_words_zh_Hans = dictionary<test_dictionary_size>::hash
+(
     false,
     {
         "的",
@@ -98,10 +98,10 @@ const test_words test_words_zh_Hans
         "人",
         "这"
     }
-};
+);
 
-const test_words test_words_zh_Hant
-{
+constexpr test_words test_words_zh_Hant = dictionary<test_dictionary_size>::hash
+(
     false,
     {
         "的",
@@ -115,7 +115,7 @@ const test_words test_words_zh_Hant
         "人",
         "這"
     }
-};
+);
 
 // This is the instance under test.
 const test_dictionaries instance
@@ -100,6 +100,14 @@ BOOST_AUTO_TEST_CASE(dictionary__index1__words__expected)
     BOOST_REQUIRE_EQUAL(instance.index(""), -1);
 }
 
+BOOST_AUTO_TEST_CASE(dictionary__index1__views__expected)
+{
+    const std::string_view text{ "abejas" };
+    BOOST_REQUIRE_EQUAL(instance.index(text.substr(0, 5)), 2);
+    BOOST_REQUIRE_EQUAL(instance.index(text), -1);
+    BOOST_REQUIRE_EQUAL(instance.index(text.substr(0, 4)), -1);
+}
+
 BOOST_AUTO_TEST_CASE(dictionary__index2__words__expected)
 {
     const auto indexes = instance.index(
@@ -31,8 +31,8 @@ const size_t test_dictionary_size = 10;
 typedef dictionary<test_dictionary_size>::words test_words;
 
 // First 10 words of BIP39 es, first word not sorted for C compare (<).
-const test_words test_words_es
-{
+constexpr test_words test_words_es = dictionary<test_dictionary_size>::hash
+(
     false,
     {
         "ábaco",
@@ -46,7 +46,7 @@ const test_words test_words_es
         "abrir",
         "abuelo"
     }
-};
+);
 
 // This is the instance under test.
 dictionary<test_dictionary_size> instance(language::es, test_words_es);
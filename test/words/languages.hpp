@@ -30,8 +30,8 @@ namespace mnemonics_languages {
 const size_t test_dictionary_size = 10;
 typedef dictionary<test_dictionary_size>::words test_words;
 
-const test_words test_words_es
-{
+constexpr test_words test_words_es = dictionary<test_dictionary_size>::hash
+(
     true,
     {
         "ábaco",
@@ -45,10 +45,10 @@ const test_words test_words_es
         "abrir",
         "abuelo"
     }
-};
+);
 
-const test_words test_words_zh_Hans
-{
+constexpr test_words test_words_zh_Hans = dictionary<test_dictionary_size>::hash
+(
     true,
     {
         "的",
@@ -62,10 +62,10 @@ const test_words test_words_zh_Hans
         "人",
         "这"
     }
-};
+);
 
-const test_words test_words_zh_Hant
-{
+constexpr test_words test_words_zh_Hant = dictionary<test_dictionary_size>::hash
+(
     true,
     {
         "的",
@@ -79,7 +79,7 @@ const test_words test_words_zh_Hant
         "人",
         "這"
     }
-};
+);
 
 // Test wrapper for access to protected methods.
 class accessor